@@ -0,0 +1,118 @@
+//
+//  density_bench.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          density_bench.c
+//%
+//% DESCRIPTION:          This script compares the atmospheric density models
+//%                       of get_density.c (NRLMSISE-00, JB2008, exponential
+//%                       and Harris-Priester). The models are evaluated at
+//%                       the same random points (altitude, latitude,
+//%                       longitude, epoch between 2004 and 2016) with the
+//%                       space weather of input/model_parameters.txt and
+//%                       the data files; the cost per call and the density
+//%                       ratio to NRLMSISE-00 are printed for each model.
+//%
+//%                       Usage: ./density_bench_exec
+//%                              ./density_bench_exec n_points alt_min alt_max
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - load_model_parameters.c
+//%                       - check_inputs.c
+//%                       - load_inputs.c
+//%                       - load_space_weather.c
+//%                       - get_density.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "load_model_parameters.h"
+#include "check_inputs.h"
+#include "load_inputs.h"
+#include "load_space_weather.h"
+#include "get_density.h"
+
+static void bench(int n_points, double alt_min, double alt_max){
+    
+    // Inputs as in main.c, with the JB2008 files loaded for all models
+    double model_parameters[N_MODEL_PARAMETERS];
+    load_model_parameters(model_parameters);
+    int length_of_file[5];
+    check_inputs(length_of_file, model_parameters);
+    static double grav_coef[5148][6], albedo[12][20][40][2];
+    double time_parameters[13], spacecraft_parameters[33], mag_coef[195][27], ap_index[length_of_file[0]], solar_input[length_of_file[1]][3], wmm_coef[90][18], iar80[106][5], rar80[106][4], eop[length_of_file[2]][10], max_dates[5][3], sun_eph[length_of_file[3]][3], moon_eph[length_of_file[4]][3];
+    struct cheb_ephemeris eph_cheb[2];
+    load_inputs(length_of_file, time_parameters, spacecraft_parameters, grav_coef, mag_coef, model_parameters, ap_index, solar_input, wmm_coef, iar80, rar80, eop, max_dates, sun_eph, moon_eph, eph_cheb, albedo);
+    struct space_weather sw;
+    load_space_weather(length_of_file, ap_index, solar_input, 2, &sw);
+    struct jb2008_cache jc = {.valid = 0};
+    double Ap = model_parameters[17];
+    double F107 = model_parameters[18];
+    
+    // Random sample points (uniform on the sphere)
+    double (*LLA)[4] = malloc(n_points*sizeof(*LLA));
+    double *t2000utc = malloc(n_points*sizeof(double));
+    double (*density)[4] = malloc(n_points*sizeof(*density));
+    srand(1);
+    for (int i=0; i<n_points; i++){
+        LLA[i][0] = asin(2.0*rand()/RAND_MAX - 1);
+        LLA[i][1] = LLA[i][0];
+        LLA[i][2] = (2.0*rand()/RAND_MAX - 1)*M_PI;
+        LLA[i][3] = alt_min + (alt_max - alt_min)*rand()/RAND_MAX;
+        t2000utc[i] = (1461 + 4383.0*rand()/RAND_MAX)*86400;
+    }
+    
+    char *names[4] = {"NRLMSISE-00", "JB2008", "Exponential", "Harris-Priester"};
+    printf("\n%d points, %g-%g km, Ap %g, F10.7 %g (0: actual data)\n\n", n_points, alt_min, alt_max, Ap, F107);
+    printf("%-16s %12s %14s %14s %14s %14s\n", "Model", "us/call", "mean ratio", "min ratio", "max ratio", "mean |log|");
+    for (int k=0; k<4; k++){
+        clock_t t0 = clock();
+        for (int i=0; i<n_points; i++)
+            density[i][k] = get_density(k+1, LLA[i], t2000utc[i], &sw, &jc, Ap, F107);
+        double t_call = (clock() - t0)*1e6/CLOCKS_PER_SEC/n_points;
+        
+        // Ratio to NRLMSISE-00
+        double sum = 0, sum_log = 0, r_min = INFINITY, r_max = 0;
+        int n = 0;
+        for (int i=0; i<n_points; i++){
+            if (density[i][k] <= 0)
+                continue;
+            double r = density[i][k]/density[i][0];
+            sum += r;
+            sum_log += fabs(log(r));
+            r_min = fmin(r_min, r);
+            r_max = fmax(r_max, r);
+            n++;
+        }
+        printf("%-16s %12.3f %14.4f %14.4f %14.4f %14.4f\n", names[k], t_call, sum/n, r_min, r_max, sum_log/n);
+    }
+    printf("\n");
+    
+    free(LLA);
+    free(t2000utc);
+    free(density);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1)
+        bench(20000, 200, 900);
+    else if (argc == 4)
+        bench(atoi(argv[1]), atof(argv[2]), atof(argv[3]));
+    else{
+        fprintf(stderr, "Usage: %s [n_points alt_min alt_max]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,182 @@
+//
+//  eph2cheb.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          eph2cheb.c
+//%
+//% DESCRIPTION:          This script converts the tabulated Sun and Moon
+//%                       ephemerides (data/sun_ephemeris.txt and
+//%                       data/moon_ephemeris.txt) into binary
+//%                       Chebyshev-segment ephemerides (data/sun_cheb.bin
+//%                       and data/moon_cheb.bin) used when the Sun/Moon
+//%                       ephemeris model is set to 2 in model_parameters.txt.
+//%                       Each segment is a least-squares fit to all table
+//%                       rows it spans, end points included.
+//%
+//%                       Usage: ./eph2cheb_exec
+//%                              ./eph2cheb_exec input.txt output.bin seg_days n_coef
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - cheb_fit.c
+//%                       - cheb_series.c
+//%                       - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include "cheb_fit.h"
+#include "cheb_series.h"
+#include "cheb_ephemeris.h"
+
+// Days from January 1, 2000 to a calendar date (proleptic Gregorian)
+static long days_since_2000(long y, long m, long d){
+    y = y - (m <= 2);
+    long era = (y >= 0 ? y : y-399)/400;
+    long yoe = y - era*400;
+    long doy = (153*(m + (m > 2 ? -3 : 9)) + 2)/5 + d-1;
+    long doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe - 730425;
+}
+
+static void convert(const char *file_in, const char *file_out, double seg_days, int n_coef){
+    
+    // Constants
+    double au = 149597870700;
+    
+    // Read table (CR, LF or CRLF line endings; '%' comment lines)
+    FILE *fp = fopen(file_in, "rb");
+    if (fp == NULL){
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", file_in, strerror( errno ));
+        exit(-1);
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = malloc(size+1);
+    if (fread(buf, 1, size, fp) != (size_t)size){
+        fprintf(stderr, "\nError reading file '%s'\n\n", file_in);
+        exit(-1);
+    }
+    buf[size] = 0;
+    fclose(fp);
+    for (long i=0; i<size; i++){
+        if (buf[i] == '\r')
+            buf[i] = '\n';
+    }
+    
+    int n = 0, n_max = 1024;
+    double *t = malloc(n_max*sizeof(*t));
+    double (*r)[3] = malloc(n_max*sizeof(*r));
+    for (char *line = strtok(buf, "\n"); line != NULL; line = strtok(NULL, "\n")){
+        if (line[0] == '%')
+            continue;
+        double Y, M, D, h, x, y, z;
+        if (sscanf(line, "%lf %lf %lf %lf %lf %lf %lf", &Y, &M, &D, &h, &x, &y, &z) != 7)
+            continue;
+        if (n == n_max){
+            n_max = 2*n_max;
+            t = realloc(t, n_max*sizeof(*t));
+            r = realloc(r, n_max*sizeof(*r));
+        }
+        t[n] = days_since_2000(Y, M, D)*86400.0 + h*3600.0;
+        r[n][0] = x*au;
+        r[n][1] = y*au;
+        r[n][2] = z*au;
+        n++;
+    }
+    free(buf);
+    if (n < 2){
+        fprintf(stderr, "\nError in '%s': no ephemeris rows found\n\n", file_in);
+        exit(-1);
+    }
+    
+    // Rows must be equally spaced and segments a whole number of rows
+    double step = t[1] - t[0];
+    for (int i=1; i<n; i++){
+        if (fabs(t[i] - t[i-1] - step) > 1e-6){
+            fprintf(stderr, "\nError in '%s': rows are not equally spaced (row %d)\n\n", file_in, i+1);
+            exit(-1);
+        }
+    }
+    int k = (int)lround(seg_days*86400.0/step);
+    if (k < 1 || fabs(k*step - seg_days*86400.0) > 1e-6 || k+1 < n_coef){
+        fprintf(stderr, "\nError: segment of %g days is not a multiple of the %g h table step or has fewer than %d rows\n\n", seg_days, step/3600.0, n_coef);
+        exit(-1);
+    }
+    int n_seg = (n-1)/k;
+    
+    // Fit segments
+    double x[k+1];
+    for (int j=0; j<=k; j++)
+        x[j] = -1 + 2.0*j/k;
+    double (*coef)[3][n_coef] = malloc(n_seg*sizeof(*coef));
+    for (int s=0; s<n_seg; s++)
+        cheb_fit(k+1, x, 3, r + s*k, n_coef, coef[s]);
+    
+    // Fit error at table rows
+    double err_max = 0;
+    for (int s=0; s<n_seg; s++){
+        for (int j=0; j<=k; j++){
+            double f[3], e = 0;
+            cheb_series(n_coef, 3, (const double (*)[n_coef])coef[s], x[j], f, NULL);
+            for (int i=0; i<3; i++)
+                e = e + (f[i] - r[s*k+j][i])*(f[i] - r[s*k+j][i]);
+            if (sqrt(e) > err_max)
+                err_max = sqrt(e);
+        }
+    }
+    
+    // Write binary file
+    struct cheb_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    strncpy(hdr.magic, CHEB_MAGIC, sizeof(hdr.magic));
+    hdr.version = CHEB_VERSION;
+    hdr.n_seg = n_seg;
+    hdr.n_coef = n_coef;
+    hdr.n_comp = 3;
+    hdr.t_start = t[0];
+    hdr.seg_len = k*step;
+    fp = fopen(file_out, "wb");
+    if (fp == NULL){
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", file_out, strerror( errno ));
+        exit(-1);
+    }
+    if (fwrite(&hdr, sizeof(hdr), 1, fp) != 1 || fwrite(coef, sizeof(*coef), n_seg, fp) != (size_t)n_seg){
+        fprintf(stderr, "\nError writing file '%s'\n\n", file_out);
+        exit(-1);
+    }
+    fclose(fp);
+    
+    printf("%s: %d rows -> %s: %d segments of %g days, %d coefficients, max fit residual %.1f m\n", file_in, n, file_out, n_seg, seg_days, n_coef, err_max);
+    
+    free(t);
+    free(r);
+    free(coef);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1){
+        convert("data/sun_ephemeris.txt", "data/sun_cheb.bin", 8, 12);
+        convert("data/moon_ephemeris.txt", "data/moon_cheb.bin", 4, 12);
+    }
+    else if (argc == 5)
+        convert(argv[1], argv[2], atof(argv[3]), atoi(argv[4]));
+    else{
+        fprintf(stderr, "Usage: %s [input.txt output.bin seg_days n_coef]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
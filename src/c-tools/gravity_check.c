@@ -0,0 +1,159 @@
+//
+//  gravity_check.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          gravity_check.c
+//%
+//% DESCRIPTION:          This script validates the batched gravity field
+//%                       (gravity_field_batch.c) against the gravity field
+//%                       of one position (gravity_field.c) with the EGM2008
+//%                       coefficients. Both are evaluated at the same random
+//%                       positions (altitude, latitude, longitude) in ECEF
+//%                       frame for several maximum degrees; the relative
+//%                       differences of the acceleration and the cost per
+//%                       position of both are printed. As a reference for
+//%                       the conditioning of the unnormalized recurrence,
+//%                       the single-position field is also compared with
+//%                       itself for positions moved by 1e-15 (relative)
+//%                       along z.
+//%
+//%                       Usage: ./gravity_check_exec
+//%                              ./gravity_check_exec n_points alt_min alt_max
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - norm_coef.c
+//%                       - gravity_field.c
+//%                       - gravity_field_batch.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include "norm_coef.h"
+#include "gravity_field.h"
+#include "gravity_field_batch.h"
+
+static double grav_coef[5148][6];
+static double C[101][101], S[101][101];
+
+static void check(int n, double alt_min, double alt_max){
+    
+    // Load and unnormalize the EGM2008 coefficients (as load_inputs.c)
+    char skip[500];
+    FILE *fp = fopen("data/EGM2008_TideFree_Coefficients.txt","r");
+    if (fp == NULL){
+        fprintf(stderr, "\nError opening file 'data/EGM2008_TideFree_Coefficients.txt': %s\n\n", strerror(errno));
+        exit(-1);
+    }
+    for (int i = 0; i < 3; i++)
+        fgets(skip, 500, fp);
+    for (int i = 0; i < 5148; i++){
+        for (int j = 0; j < 6; j++)
+            fscanf(fp, "%lf", &grav_coef[i][j]);
+    }
+    fclose(fp);
+    norm_coef(grav_coef, C, S);
+    
+    // Random positions (uniform on the sphere, away from the poles where both are singular)
+    double (*p)[3] = malloc(n*sizeof(*p));
+    double (*lla)[4] = malloc(n*sizeof(*lla));
+    double (*a_s)[3] = malloc(n*sizeof(*a_s));
+    double (*a_b)[3] = malloc(n*sizeof(*a_b));
+    double (*p_c)[3] = malloc(n*sizeof(*p_c));
+    double (*lla_c)[4] = malloc(n*sizeof(*lla_c));
+    double (*a_c)[3] = malloc(n*sizeof(*a_c));
+    srand(1);
+    for (int i = 0; i < n; i++){
+        double r = 6378136.3 + 1000*(alt_min + (alt_max - alt_min)*rand()/RAND_MAX);
+        double lat = asin(0.998*(2.0*rand()/RAND_MAX - 1));
+        double lon = (2.0*rand()/RAND_MAX - 1)*M_PI;
+        p[i][0] = r*cos(lat)*cos(lon);
+        p[i][1] = r*cos(lat)*sin(lon);
+        p[i][2] = r*sin(lat);
+        lla[i][0] = lat;
+        lla[i][1] = lat;
+        lla[i][2] = lon;
+        lla[i][3] = alt_min;
+        p_c[i][0] = p[i][0];
+        p_c[i][1] = p[i][1];
+        p_c[i][2] = p[i][2]*(1 + 1e-15);
+        for (int k = 0; k < 4; k++)
+            lla_c[i][k] = lla[i][k];
+        lla_c[i][0] = asin(p_c[i][2]/sqrt(p_c[i][0]*p_c[i][0] + p_c[i][1]*p_c[i][1] + p_c[i][2]*p_c[i][2]));
+        lla_c[i][1] = lla_c[i][0];
+    }
+    
+    printf("\n%d positions, %g-%g km\n\n", n, alt_min, alt_max);
+    printf("Degree    Batch - single          Conditioning    Single      Batch\n");
+    printf("          max         mean        max             (us)        (us)\n");
+    
+    int degrees[4] = {10, 20, 50, 100};
+    for (int d = 0; d < 4; d++){
+        int l_max = degrees[d];
+        
+        // One position per call, acceleration in ECEF frame (p = p_ecef)
+        double C_i2b[3][3] = {{1,0,0},{0,1,0},{0,0,1}}, Inertia[3][3] = {{1,0,0},{0,1,0},{0,0,1}}, g[3];
+        clock_t t0 = clock();
+        for (int i = 0; i < n; i++)
+            gravity_field(p[i], p[i], lla[i], C_i2b, Inertia, C, S, l_max, l_max, 1, 0, a_s[i], g, NULL);
+        double t_s = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+        
+        // Batch
+        t0 = clock();
+        gravity_field_batch(n, p, C, S, l_max, a_b);
+        double t_b = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+        
+        // Moved positions
+        for (int i = 0; i < n; i++)
+            gravity_field(p_c[i], p_c[i], lla_c[i], C_i2b, Inertia, C, S, l_max, l_max, 1, 0, a_c[i], g, NULL);
+        
+        // Relative differences of the acceleration vectors
+        double d_max = 0, d_sum = 0, c_max = 0;
+        for (int i = 0; i < n; i++){
+            double da = 0, dc = 0, as = 0;
+            for (int k = 0; k < 3; k++){
+                da += (a_b[i][k] - a_s[i][k])*(a_b[i][k] - a_s[i][k]);
+                dc += (a_c[i][k] - a_s[i][k])*(a_c[i][k] - a_s[i][k]);
+                as += a_s[i][k]*a_s[i][k];
+            }
+            d_max = fmax(d_max, sqrt(da/as));
+            d_sum += sqrt(da/as);
+            c_max = fmax(c_max, sqrt(dc/as));
+        }
+        printf("%6d    %.3e   %.3e   %.3e       %-8.3f    %.3f\n", l_max, d_max, d_sum/n, c_max, t_s, t_b);
+    }
+    printf("\n");
+    
+    free(p);
+    free(lla);
+    free(a_s);
+    free(a_b);
+    free(p_c);
+    free(lla_c);
+    free(a_c);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1)
+        check(2000, 200, 36000);
+    else if (argc == 4)
+        check(atoi(argv[1]), atof(argv[2]), atof(argv[3]));
+    else{
+        fprintf(stderr, "Usage: %s [n_points alt_min alt_max]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,159 @@
+//
+//  hwm14_check.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          hwm14_check.c
+//%
+//% DESCRIPTION:          This script validates the native Horizontal Wind
+//%                       Model 2014 (hwm14_native.c) against the Fortran
+//%                       model (hwm14.f90). Both are evaluated at the same
+//%                       random points (altitude, latitude, longitude) for
+//%                       random epochs and ap indices, with all points of
+//%                       an epoch evaluated together (as for an ensemble);
+//%                       the wind differences and the cost per point of
+//%                       the Fortran model, the native model and its batch
+//%                       entry point are printed.
+//%
+//%                       Usage: ./hwm14_check_exec
+//%                              ./hwm14_check_exec n_epochs n_points alt_min alt_max
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - load_hwm14.c
+//%                       - hwm14_native.c
+//%                       - hwm14.f90
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "load_hwm14.h"
+#include "hwm14_native.h"
+
+extern void hwm14_(int *iyd, float *sec, float *alt, float *lat, float *lon, float *stl, float f107a[2], float f107[2], float ap[2], float w[2]);
+
+static void check(int n_epochs, int n_points, double alt_min, double alt_max){
+    
+    struct hwm14_model hwm;
+    load_hwm14(&hwm);
+    
+    // Random epochs and sample points (uniform on the sphere)
+    int *iyd = malloc(n_epochs*sizeof(int));
+    float *sec = malloc(n_epochs*sizeof(float));
+    float *ap = malloc(n_epochs*sizeof(float));
+    int n = n_epochs*n_points;
+    float *alt = malloc(n*sizeof(float));
+    float *lat = malloc(n*sizeof(float));
+    float *lon = malloc(n*sizeof(float));
+    double (*w_f)[2] = malloc(n*sizeof(*w_f));
+    double (*w_c)[2] = malloc(n*sizeof(*w_c));
+    double (*w_b)[2] = malloc(n*sizeof(*w_b));
+    srand(1);
+    for (int j=0; j<n_epochs; j++){
+        iyd[j] = 1000*(rand() % 20) + 1 + rand() % 365;
+        sec[j] = (int) (86400.0*rand()/RAND_MAX);
+        ap[j] = (j % 4 == 0) ? -1 : (int) (400.0*rand()/RAND_MAX);
+    }
+    for (int i=0; i<n; i++){
+        alt[i] = alt_min + (alt_max - alt_min)*rand()/RAND_MAX;
+        lat[i] = asin(2.0*rand()/RAND_MAX - 1)*180/M_PI;
+        lon[i] = (2.0*rand()/RAND_MAX - 1)*180;
+    }
+    
+    // Fortran model
+    float stl = 0, f107[2] = {0,0}, f107a[2] = {0,0};
+    clock_t t0 = clock();
+    for (int j=0; j<n_epochs; j++){
+        float ap_hwm[2] = {0, ap[j]};
+        for (int k=0; k<n_points; k++){
+            int i = j*n_points + k;
+            float w[2];
+            hwm14_(&iyd[j], &sec[j], &alt[i], &lat[i], &lon[i], &stl, f107a, f107, ap_hwm, w);
+            w_f[i][0] = w[0];
+            w_f[i][1] = w[1];
+        }
+    }
+    double t_f = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+    
+    // Native model, point by point
+    t0 = clock();
+    for (int j=0; j<n_epochs; j++){
+        for (int k=0; k<n_points; k++){
+            int i = j*n_points + k;
+            hwm14_eval(&hwm, iyd[j], sec[j], ap[j], alt[i], lat[i], lon[i], w_c[i]);
+        }
+    }
+    double t_c = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+    
+    // Native model, batch per epoch
+    double *alt_b = malloc(n*sizeof(double));
+    double *lat_b = malloc(n*sizeof(double));
+    double *lon_b = malloc(n*sizeof(double));
+    for (int i=0; i<n; i++){
+        alt_b[i] = alt[i];
+        lat_b[i] = lat[i];
+        lon_b[i] = lon[i];
+    }
+    t0 = clock();
+    for (int j=0; j<n_epochs; j++){
+        int i = j*n_points;
+        hwm14_eval_batch(&hwm, iyd[j], sec[j], ap[j], n_points, &alt_b[i], &lat_b[i], &lon_b[i], &w_b[i]);
+    }
+    double t_b = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+    
+    // Differences to the Fortran model
+    double d_max = 0, d_sum = 0, w_max = 0, b_max = 0;
+    for (int i=0; i<n; i++){
+        for (int k=0; k<2; k++){
+            double d = fabs(w_c[i][k] - w_f[i][k]);
+            d_max = fmax(d_max, d);
+            d_sum += d;
+            w_max = fmax(w_max, fabs(w_f[i][k]));
+            b_max = fmax(b_max, fabs(w_b[i][k] - w_c[i][k]));
+        }
+    }
+    
+    printf("\n%d epochs x %d points, %g-%g km, ap 0-400 (none for 1 epoch in 4)\n\n", n_epochs, n_points, alt_min, alt_max);
+    printf("Largest wind component:             %12.3f m/s\n", w_max);
+    printf("Native - Fortran, max:              %12.3e m/s\n", d_max);
+    printf("Native - Fortran, mean:             %12.3e m/s\n", d_sum/(2*n));
+    printf("Batch - native, max:                %12.3e m/s\n\n", b_max);
+    printf("Fortran:                            %12.3f us/point\n", t_f);
+    printf("Native:                             %12.3f us/point\n", t_c);
+    printf("Native, batch:                      %12.3f us/point\n\n", t_b);
+    
+    free(iyd);
+    free(sec);
+    free(ap);
+    free(alt);
+    free(lat);
+    free(lon);
+    free(w_f);
+    free(w_c);
+    free(w_b);
+    free(alt_b);
+    free(lat_b);
+    free(lon_b);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1)
+        check(200, 100, 0, 1000);
+    else if (argc == 5)
+        check(atoi(argv[1]), atoi(argv[2]), atof(argv[3]), atof(argv[4]));
+    else{
+        fprintf(stderr, "Usage: %s [n_epochs n_points alt_min alt_max]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,168 @@
+//
+//  msis2tab.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          msis2tab.c
+//%
+//% DESCRIPTION:          This script tabulates NRLMSISE-00 total mass
+//%                       density for the constant Ap and F10.7 of
+//%                       input/model_parameters.txt on a regular (altitude,
+//%                       geodetic latitude, longitude, local solar time,
+//%                       day of year) grid and writes the binary table
+//%                       (data/density_table.bin) used when the density
+//%                       table is enabled in model_parameters.txt. The
+//%                       model is evaluated as in get_density.c, with the
+//%                       universal time given by longitude and local time.
+//%
+//%                       Usage: ./msis2tab_exec
+//%                              ./msis2tab_exec output.bin alt_min alt_max d_alt d_lat n_lon n_lst n_doy
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - load_model_parameters.c
+//%                       - nrlmsise-00.c
+//%                       - density_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include "load_model_parameters.h"
+#include "nrlmsise-00.h"
+#include "density_table.h"
+
+static void tabulate(const char *file_out, double alt_min, double alt_max, double d_alt, double d_lat, int n_lon, int n_lst, int n_doy){
+    
+    // Constant space weather
+    double model_parameters[N_MODEL_PARAMETERS];
+    load_model_parameters(model_parameters);
+    double Ap = model_parameters[17];
+    double F107 = model_parameters[18];
+    if (Ap == 0 || F107 == 0){
+        fprintf(stderr, "\nError: the density table needs constant Ap and F10.7 (non-zero on line 2 of 'model_parameters.txt')\n\n");
+        exit(-1);
+    }
+    
+    // Grid
+    struct density_table_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    strncpy(hdr.magic, DENSITY_TABLE_MAGIC, sizeof(hdr.magic));
+    hdr.version = DENSITY_TABLE_VERSION;
+    hdr.atmos_model = 1;
+    hdr.n_dim = 5;
+    hdr.Ap = Ap;
+    hdr.F107 = F107;
+    hdr.n[0] = (int)lround((alt_max - alt_min)/d_alt) + 1;
+    hdr.n[1] = (int)lround(180.0/d_lat) + 1;
+    hdr.n[2] = n_lon;
+    hdr.n[3] = n_lst;
+    hdr.n[4] = n_doy;
+    hdr.x0[0] = alt_min;
+    hdr.x0[1] = -90.0;
+    hdr.x0[2] = -180.0;
+    hdr.x0[3] = 0.0;
+    hdr.x0[4] = 1.0;
+    hdr.dx[0] = d_alt;
+    hdr.dx[1] = d_lat;
+    hdr.dx[2] = 360.0/n_lon;
+    hdr.dx[3] = 24.0/n_lst;
+    hdr.dx[4] = 365.0/n_doy;
+    if (alt_min < 72.5 || hdr.n[0] < 2 || hdr.n[1] < 3 || fabs((hdr.n[1]-1)*d_lat - 180.0) > 1e-9 || n_lon < 2 || n_lst < 2 || n_doy < 2){
+        fprintf(stderr, "\nError: invalid density table grid (altitudes from 72.5 km, latitude step dividing 180 deg, at least 2 longitudes, local times and days)\n\n");
+        exit(-1);
+    }
+    size_t n_nodes = (size_t)hdr.n[0]*hdr.n[1]*hdr.n[2]*hdr.n[3]*hdr.n[4];
+    float *log_rho = malloc(n_nodes*sizeof(float));
+    
+    // NRLMSISE-00 inputs as in get_density.c
+    struct nrlmsise_input input;
+    struct nrlmsise_flags flags;
+    struct ap_array aph;
+    flags.switches[0]=0;
+    for (int i=1;i<24;i++)
+        flags.switches[i]=1;
+    for (int i=0; i<7; i++)
+        aph.a[i] = Ap;
+    input.year = 0;
+    input.f107 = F107;
+    input.f107A = F107;
+    input.ap = Ap;
+    input.ap_a = &aph;
+    
+    // Altitude-latitude planes at one epoch and local time, evaluated together
+    int n_plane = hdr.n[0]*hdr.n[1];
+    double *alt = malloc(n_plane*sizeof(double));
+    double *lat = malloc(n_plane*sizeof(double));
+    double *lon = malloc(n_plane*sizeof(double));
+    double *lst = malloc(n_plane*sizeof(double));
+    double *rho = malloc(n_plane*sizeof(double));
+    for (int j=0; j<hdr.n[1]; j++){
+        for (int i=0; i<hdr.n[0]; i++){
+            alt[j*hdr.n[0] + i] = hdr.x0[0] + i*hdr.dx[0];
+            lat[j*hdr.n[0] + i] = hdr.x0[1] + j*hdr.dx[1];
+        }
+    }
+    
+    size_t idx = 0;
+    for (int m=0; m<hdr.n[4]; m++){
+        input.doy = hdr.x0[4] + m*hdr.dx[4];
+        for (int l=0; l<hdr.n[3]; l++){
+            input.lst = hdr.x0[3] + l*hdr.dx[3];
+            for (int k=0; k<hdr.n[2]; k++){
+                input.g_long = hdr.x0[2] + k*hdr.dx[2];
+                input.sec = fmod(input.lst - input.g_long/15.0 + 48.0, 24.0)*3600.0;
+                for (int i=0; i<n_plane; i++){
+                    lon[i] = input.g_long;
+                    lst[i] = input.lst;
+                }
+                gtd7_rho_batch(&input, n_plane, alt, lat, lon, lst, &flags, rho);
+                for (int i=0; i<n_plane; i++)
+                    log_rho[idx++] = log(rho[i]*1000);
+            }
+        }
+    }
+    
+    // Write binary file
+    FILE *fp = fopen(file_out, "wb");
+    if (fp == NULL){
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", file_out, strerror( errno ));
+        exit(-1);
+    }
+    if (fwrite(&hdr, sizeof(hdr), 1, fp) != 1 || fwrite(log_rho, sizeof(float), n_nodes, fp) != n_nodes){
+        fprintf(stderr, "\nError writing file '%s'\n\n", file_out);
+        exit(-1);
+    }
+    fclose(fp);
+    
+    printf("%s: Ap %g, F10.7 %g, %d altitudes (%g-%g km), %d latitudes, %d longitudes, %d local times, %d days (%.1f MB)\n", file_out, Ap, F107, hdr.n[0], alt_min, alt_max, hdr.n[1], hdr.n[2], hdr.n[3], hdr.n[4], (sizeof(hdr) + n_nodes*sizeof(float))/1e6);
+    
+    free(log_rho);
+    free(alt);
+    free(lat);
+    free(lon);
+    free(lst);
+    free(rho);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1)
+        tabulate("data/density_table.bin", 100, 1000, 10, 7.5, 12, 24, 24);
+    else if (argc == 9)
+        tabulate(argv[1], atof(argv[2]), atof(argv[3]), atof(argv[4]), atof(argv[5]), atoi(argv[6]), atoi(argv[7]), atoi(argv[8]));
+    else{
+        fprintf(stderr, "Usage: %s [output.bin alt_min alt_max d_alt d_lat n_lon n_lst n_doy]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
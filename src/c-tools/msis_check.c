@@ -0,0 +1,167 @@
+//
+//  msis_check.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% SCRIPT NAME:          msis_check.c
+//%
+//% DESCRIPTION:          This script validates the density-only entry
+//%                       points of NRLMSISE-00 (gtd7_rho and
+//%                       gtd7_rho_batch) against the total mass density
+//%                       of gtd7. All are evaluated at the same random
+//%                       points (altitude, latitude, longitude) for random
+//%                       epochs and space weather, in both ap modes (daily
+//%                       ap, and the 3-hour ap history), with all points
+//%                       of an epoch evaluated together; the relative
+//%                       differences and the cost per point are printed.
+//%
+//%                       Usage: ./msis_check_exec
+//%                              ./msis_check_exec n_epochs n_points alt_min alt_max
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% COUPLING:             - nrlmsise-00.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "nrlmsise-00.h"
+
+static void check(int n_epochs, int n_points, double alt_min, double alt_max){
+    
+    // Random epochs, space weather and sample points (uniform on the sphere)
+    int n = n_epochs*n_points;
+    struct nrlmsise_input *epoch = malloc(n_epochs*sizeof(struct nrlmsise_input));
+    struct ap_array *aph = malloc(n_epochs*sizeof(struct ap_array));
+    double *alt = malloc(n*sizeof(double));
+    double *lat = malloc(n*sizeof(double));
+    double *lon = malloc(n*sizeof(double));
+    double *lst = malloc(n*sizeof(double));
+    double *rho_d = malloc(n*sizeof(double));
+    double *rho_r = malloc(n*sizeof(double));
+    double *rho_b = malloc(n*sizeof(double));
+    srand(1);
+    for (int j=0; j<n_epochs; j++){
+        epoch[j].year = 0;
+        epoch[j].doy = 1 + rand() % 365;
+        epoch[j].sec = (int) (86400.0*rand()/RAND_MAX);
+        epoch[j].f107A = 70 + 180.0*rand()/RAND_MAX;
+        epoch[j].f107 = epoch[j].f107A + 40*(2.0*rand()/RAND_MAX - 1);
+        epoch[j].ap = (int) (200.0*rand()/RAND_MAX);
+        for (int k=0; k<7; k++)
+            aph[j].a[k] = (int) (200.0*rand()/RAND_MAX);
+        epoch[j].ap_a = &aph[j];
+        epoch[j].alt = 0;
+        epoch[j].g_lat = 0;
+        epoch[j].g_long = 0;
+        epoch[j].lst = 0;
+    }
+    for (int j=0; j<n_epochs; j++){
+        for (int k=0; k<n_points; k++){
+            int i = j*n_points + k;
+            alt[i] = alt_min + (alt_max - alt_min)*rand()/RAND_MAX;
+            lat[i] = asin(2.0*rand()/RAND_MAX - 1)*180/M_PI;
+            lon[i] = (2.0*rand()/RAND_MAX - 1)*180;
+            lst[i] = fmod(epoch[j].sec/3600.0 + lon[i]/15.0 + 48.0, 24.0);
+        }
+    }
+    
+    printf("\n%d epochs x %d points, %g-%g km, both ap modes\n", n_epochs, n_points, alt_min, alt_max);
+    
+    for (int mode=0; mode<2; mode++){
+        
+        struct nrlmsise_flags flags;
+        flags.switches[0] = 0;
+        for (int k=1; k<24; k++)
+            flags.switches[k] = 1;
+        if (mode == 1)
+            flags.switches[9] = -1;
+        
+        // gtd7, point by point
+        clock_t t0 = clock();
+        for (int j=0; j<n_epochs; j++){
+            struct nrlmsise_input input = epoch[j];
+            struct nrlmsise_output output;
+            for (int k=0; k<n_points; k++){
+                int i = j*n_points + k;
+                input.alt = alt[i];
+                input.g_lat = lat[i];
+                input.g_long = lon[i];
+                input.lst = lst[i];
+                gtd7(&input, &flags, &output);
+                rho_d[i] = output.d[5];
+            }
+        }
+        double t_d = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+        
+        // gtd7_rho, point by point
+        t0 = clock();
+        for (int j=0; j<n_epochs; j++){
+            struct nrlmsise_input input = epoch[j];
+            for (int k=0; k<n_points; k++){
+                int i = j*n_points + k;
+                input.alt = alt[i];
+                input.g_lat = lat[i];
+                input.g_long = lon[i];
+                input.lst = lst[i];
+                rho_r[i] = gtd7_rho(&input, &flags);
+            }
+        }
+        double t_r = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+        
+        // gtd7_rho_batch, per epoch
+        t0 = clock();
+        for (int j=0; j<n_epochs; j++){
+            int i = j*n_points;
+            gtd7_rho_batch(&epoch[j], n_points, &alt[i], &lat[i], &lon[i], &lst[i], &flags, &rho_b[i]);
+        }
+        double t_b = (clock() - t0)*1e6/CLOCKS_PER_SEC/n;
+        
+        // Relative differences to gtd7
+        double r_max = 0, b_max = 0;
+        for (int i=0; i<n; i++){
+            r_max = fmax(r_max, fabs(rho_r[i]/rho_d[i] - 1));
+            b_max = fmax(b_max, fabs(rho_b[i]/rho_d[i] - 1));
+        }
+        
+        printf("\n%s\n\n", (mode == 0) ? "Daily ap" : "3-hour ap history");
+        printf("gtd7_rho - gtd7, max:               %12.3e\n", r_max);
+        printf("gtd7_rho_batch - gtd7, max:         %12.3e\n\n", b_max);
+        printf("gtd7:                               %12.3f us/point\n", t_d);
+        printf("gtd7_rho:                           %12.3f us/point\n", t_r);
+        printf("gtd7_rho_batch:                     %12.3f us/point\n", t_b);
+    }
+    printf("\n");
+    
+    free(epoch);
+    free(aph);
+    free(alt);
+    free(lat);
+    free(lon);
+    free(lst);
+    free(rho_d);
+    free(rho_r);
+    free(rho_b);
+}
+
+int main(int argc, char *argv[]){
+    
+    if (argc == 1)
+        check(200, 500, 0, 1000);
+    else if (argc == 5)
+        check(atoi(argv[1]), atoi(argv[2]), atof(argv[3]), atof(argv[4]));
+    else{
+        fprintf(stderr, "Usage: %s [n_epochs n_points alt_min alt_max]\n", argv[0]);
+        return -1;
+    }
+    
+    return 0;
+}
@@ -9,7 +9,12 @@
 //% FUNCTION NAME:        aero_drag.c
 //%
 //% DESCRIPTION:          This function calculates the acceleration and
-//%                       torque due to atmospheric drag
+//%                       torque due to atmospheric drag. The force and torque
+//%                       are linear combinations of sums over the surfaces
+//%                       in view of the wind which only depend on the wind
+//%                       direction in body frame, obtained in a single pass
+//%                       over the surfaces or interpolated in the facet
+//%                       response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 September 13, 2017
@@ -22,8 +27,9 @@
 //%                       double w[3]: angular velocity vector (rad s-1)
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       double Cd: drag coefficient
 //%                       int in_aero_a: inclusion of acceleration?
@@ -33,26 +39,26 @@
 //%                         drag in inertial frame
 //%                       double g_aero[3]: torque due to atmospheric drag
 //%                         in body frame
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces (without the table)
 //%
-//% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - aero_force.c
-//%                       - aero_torque.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_drag.c
+//%                       - facet_table_eval.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "aero_drag.h"
+#include "linalg.h"
 #include <math.h>
-#include "invertmat.h"
-#include "vectors2angle.h"
-#include "aero_force.h"
-#include "aero_torque.h"
-#include "surface.h"
-#include "matxvec.h"
+#include "facets.h"
+#include "facet_table.h"
+#include "facets_drag.h"
+#include "facet_table_eval.h"
 
-void aero_drag(double density, double w_vector[3], double p[3], double v[3], double w[3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, double Cd, int in_aero_a, int in_aero_g, double a_aero[3], double g_aero[3]){
+void aero_drag(double density, double w_vector[3], double p[3], double v[3], double w[3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, double Cd, int in_aero_a, int in_aero_g, double a_aero[3], double g_aero[3]){
     
     for (int i=0; i<3; i++){
         a_aero[i] = 0;
@@ -69,69 +75,52 @@ void aero_drag(double density, double w_vector[3], double p[3], double v[3], dou
     
     // Switch from inertial frame to body frame
     double rel_wind_body[3];
-    matxvec(C_i2b, rel_wind_inertial, rel_wind_body);
+    mat3_vec(C_i2b, rel_wind_inertial, rel_wind_body);
     
     // Inverse body rotation matrix
     double C_b2i[3][3];
-    invertmat(C_i2b,C_b2i);
-    
-    // Switch body angular velocity from body to inertial
-    double w_i[3];
-    matxvec(C_b2i, w, w_i);
-    
-    // Calculate relative atmosphere angular velocity inertial frame
-    double w_rel_i[3];
-    for (int i=0; i<3; i++)
-        w_rel_i[i] = w_i[i] - w_atmos[i];
+    mat3_transpose(C_i2b,C_b2i);
     
     // Switch atmos angular velocity to body frame
     double w_atmos_b[3];
-    matxvec(C_i2b, w_atmos, w_atmos_b);
+    mat3_vec(C_i2b, w_atmos, w_atmos_b);
     
     // Calculate relative atmosphere angular velocity in body frame
     double w_rel_b[3];
     for (int i=0; i<3; i++)
         w_rel_b[i] = w[i] - w_atmos_b[i];
     
-    // Find angle between wind and surface normal to obtain surfaces in view of wind
-    double tot_proj_surf = 0;
-    double A_cross = 0;
-    double alpha[n_surf], cos_alpha[n_surf];
-    for (int i=0; i<n_surf; i++){
-        alpha[i] = vectors2angle(rel_wind_body,geometry[i].normal);
-        cos_alpha[i] = cos(alpha[i]);
-        // If surface is in view calculate projected surface area
-        if (cos_alpha[i]>0){
-            geometry[i].projected_area = cos_alpha[i]*geometry[i].area;
-        }
-        else {
-            geometry[i].projected_area = 0;
-        }
-        tot_proj_surf = tot_proj_surf + geometry[i].projected_area;
-    }
-    A_cross = tot_proj_surf;
+    double vb = vec3_norm(rel_wind_body);
+    if (vb == 0)
+        return;
+    
+    // Sums over the surfaces in view of the wind, from the facet response
+    // table or from a pass over the surfaces (see facets_drag.c)
+    double d[3], coef[FACETS_DRAG_N];
+    for (int i=0; i<3; i++)
+        d[i] = rel_wind_body[i]/vb;
+    if (ft->n > 0)
+        facet_table_eval(ft, d, 0, FACETS_DRAG_N, coef);
+    else
+        facets_drag(fa, d, coef);
+    
+    double K = density*Cd/2.0;
     
     //// FORCE CALCULATION
     if (in_aero_a){
         
-        //Calculate for each surface
-        double f_aero[3];
+        // Force in body frame: translation term, rotation term along the
+        // wind and rotation term normal to the wind
+        double Apcxw[3];
+        vec3_cross(&coef[1], w_rel_b, Apcxw);
+        double f_along = vb*coef[0] - vec3_dot(w_rel_b, &coef[4]);
+        double f_body[3];
         for (int i=0; i<3; i++)
-            f_aero[i] = 0;
-        for (int i=0; i<n_surf; i++){
-            
-            // If in view
-            if (cos_alpha[i]>0){
-                
-                double f_surf[3];
-                aero_force(density, Cd, rel_wind_inertial, w_rel_i, geometry[i], C_b2i, f_surf);
-                
-                // Sum total force
-                for (int j=0; j<3; j++)
-                    f_aero[j] = f_aero[j] + f_surf[j];
-            }
-        }
-        // Acceleration
+            f_body[i] = K*(f_along*rel_wind_body[i] + vb*Apcxw[i]);
+        
+        // Acceleration in inertial frame
+        double f_aero[3];
+        mat3_vec(C_b2i, f_body, f_aero);
         for (int i=0; i<3; i++)
             a_aero[i] = f_aero[i]/m;
     
@@ -140,20 +129,22 @@ void aero_drag(double density, double w_vector[3], double p[3], double v[3], dou
     //// TORQUE CALCULATION
     if (in_aero_g){
         
-        // Calculate for each surface
-        for (int i=0; i<n_surf; i++){
-            
-            // If in view
-            if (cos_alpha[i]>0){
-                
-                double g_surf[3];
-                aero_torque(density, Cd, rel_wind_body, w_rel_b, geometry[i], g_surf);
-                
-                // Sum total torque
-                for (int j=0; j<3; j++)
-                    g_aero[j] = g_aero[j] + g_surf[j];
-            }
+        // S1 = sum(A*(n.v)*c - Q*u), s2 = sum((n.v)*tr(Q)), S3 = sum((n.v)*Q*w)
+        double S1[3], S3[3], s2 = vb*coef[19];
+        double M2[3][3] = {{coef[10],coef[11],coef[12]},{coef[13],coef[14],coef[15]},{coef[16],coef[17],coef[18]}};
+        double M3[3][3] = {{coef[20],coef[21],coef[22]},{coef[21],coef[23],coef[24]},{coef[22],coef[24],coef[25]}};
+        double M2w[3], M3w[3];
+        mat3_vec(M2, w_rel_b, M2w);
+        mat3_vec(M3, w_rel_b, M3w);
+        for (int i=0; i<3; i++){
+            S1[i] = vb*coef[7+i] - M2w[i];
+            S3[i] = vb*M3w[i];
         }
+        
+        double S1xv[3];
+        vec3_cross(S1, rel_wind_body, S1xv);
+        for (int i=0; i<3; i++)
+            g_aero[i] = K*(S1xv[i] - s2*w_rel_b[i] + S3[i]);
 
     }
 }
@@ -9,7 +9,12 @@
 //% FUNCTION NAME:        aero_drag.c
 //%
 //% DESCRIPTION:          This function calculates the acceleration and
-//%                       torque due to atmospheric drag
+//%                       torque due to atmospheric drag. The force and torque
+//%                       are linear combinations of sums over the surfaces
+//%                       in view of the wind which only depend on the wind
+//%                       direction in body frame, obtained in a single pass
+//%                       over the surfaces or interpolated in the facet
+//%                       response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 September 13, 2017
@@ -22,8 +27,9 @@
 //%                       double w[3]: angular velocity vector (rad s-1)
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       double Cd: drag coefficient
 //%                       int in_aero_a: inclusion of acceleration?
@@ -33,13 +39,14 @@
 //%                         drag in inertial frame
 //%                       double g_aero[3]: torque due to atmospheric drag
 //%                         in body frame
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces (without the table)
 //%
-//% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - aero_force.c
-//%                       - aero_torque.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_drag.c
+//%                       - facet_table_eval.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -47,8 +54,9 @@
 #define aero_drag_h
 
 #include <stdio.h>
-#include "surface.h"
+#include "facets.h"
+#include "facet_table.h"
 
-void aero_drag(double density, double w_vector[3], double p[3], double v[3], double w[3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, double Cd, int in_aero_a, int in_aero_g, double a_aero[3], double g_aero[3]);
+void aero_drag(double density, double w_vector[3], double p[3], double v[3], double w[3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, double Cd, int in_aero_a, int in_aero_g, double a_aero[3], double g_aero[3]);
 
 #endif /* aero_drag_h */
@@ -10,7 +10,10 @@
 //%
 //% DESCRIPTION:          This function calculates the acceleration and
 //%                       torque due to reflected and emitted Earth radiation
-//%                       (See Section 2.3.3 in Sagnieres (2018) Doctoral Thesis)
+//%                       (See Section 2.3.3 in Sagnieres (2018) Doctoral Thesis).
+//%                       The force and torque of all surfaces are evaluated
+//%                       together in body frame for each Earth grid, or
+//%                       interpolated in the facet response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 July 2, 2018
@@ -32,8 +35,9 @@
 //%                         frame to TEME
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       double albedo[12][20][40][2]: albedo and IR coefficients
 //%                       int in_alb_a: inclusion of albedo acceleration?
@@ -51,24 +55,19 @@
 //%                         in body-fixed frame
 //%
 //% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - norm.c
-//%                       - crossprod.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//%                       - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "albedo_calc.h"
-#include "surface.h"
-#include "matxvec.h"
-#include "vectors2angle.h"
-#include "norm.h"
-#include "crossprod.h"
+#include "linalg.h"
+#include "facets.h"
+#include "facet_table.h"
+#include "facets_radiation.h"
+#include "facet_table_eval.h"
 #include <math.h>
-#include "invertmat.h"
 
-void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_sun[3], double C_ecef2teme[3][3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, double albedo[12][20][40][2], int in_alb_a, int in_alb_g, int in_ir_a, int in_ir_g, double a_alb[3], double g_alb[3], double a_ir[3], double g_ir[3]){
+void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_sun[3], double C_ecef2teme[3][3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, double albedo[12][20][40][2], int in_alb_a, int in_alb_g, int in_ir_a, int in_ir_g, double a_alb[3], double g_alb[3], double a_ir[3], double g_ir[3]){
     
     for (int i=0; i<3; i++){
         a_alb[i] = 0;
@@ -77,15 +76,6 @@ void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_
         g_ir[i] = 0;
     }
     
-    // Initialize acceleration for each surface
-    double f_surf[n_surf][2][3];
-    for (int k=0; k<n_surf; k++){
-        for (int i=0; i<3; i++){
-            f_surf[k][0][i] = 0;
-            f_surf[k][1][i] = 0;
-        }
-    }
-    
     // Surface area for each Grid (9° x 9°) as a function of latitude (90-81 to 9-0) independent of longitude (in m^2)
     double grid_area[20] = {79189845238,
         235467450694,
@@ -183,9 +173,9 @@ void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_
             grid_position_ecef[i][j][1] = re*cos((90-4.5-9*i)*M_PI/180.0)*sin((4.5+9*j)*M_PI/180.0);
             grid_position_ecef[i][j][2] = re*sqrt(1-eesqrd)*sin((90-4.5-9*i)*M_PI/180.0);
             
-            norm_grid_position[i][j] = norm(grid_position_ecef[i][j]);
+            norm_grid_position[i][j] = vec3_norm(grid_position_ecef[i][j]);
             
-            matxvec(C_ecef2teme, grid_position_ecef[i][j], grid_position_eci[i][j]);
+            mat3_vec(C_ecef2teme, grid_position_ecef[i][j], grid_position_eci[i][j]);
             
             unit_grid_eci[i][j][0] = grid_position_eci[i][j][0]/norm_grid_position[i][j];
             unit_grid_eci[i][j][1] = grid_position_eci[i][j][1]/norm_grid_position[i][j];
@@ -195,12 +185,21 @@ void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_
     
     // Inverse body rotation matrix
     double C_b2i[3][3];
-    invertmat(C_i2b,C_b2i);
+    mat3_transpose(C_i2b,C_b2i);
     
     // Solar Flux
-    double rsun = norm(r_sun);
+    double rsun = vec3_norm(r_sun);
     double phi = 1361*(149597870700.0/rsun)*(149597870700.0/rsun);
     
+    // Speed of light
+    double c = 299792458.0;
+    
+    // Total force and torque in body frame
+    double f_alb_b[3] = {0,0,0}, g_alb_b[3] = {0,0,0};
+    double f_ir_b[3] = {0,0,0}, g_ir_b[3] = {0,0,0};
+    int alb = in_alb_a || in_alb_g;
+    int ir = in_ir_a || in_ir_g;
+    
     // For each Earth grid
     for (int i=0; i<20; i++){
         for (int j=0; j<40; j++){
@@ -210,75 +209,62 @@ void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_
             for (int l=0; l<3; l++){
                 grid_sat_pos[l] = p[l] - grid_position_eci[i][j][l];
             }
-            double grid_sat_dist = norm(grid_sat_pos);
+            double grid_sat_dist = vec3_norm(grid_sat_pos);
             
             // Check if grid is in view of satellite
-            double grid_view_sat = vectors2angle(unit_grid_eci[i][j],grid_sat_pos);
+            double grid_view_sat = vec3_angle(unit_grid_eci[i][j],grid_sat_pos);
             double cos_grid_view_sat = cos(grid_view_sat);
             
             // If grid is in view of satellite
             if (cos_grid_view_sat>0){
                 
                 // Check if Earth grid is in view of sun
-                double grid_view_sun = vectors2angle(unit_grid_eci[i][j],r_sun);
+                double grid_view_sun = vec3_angle(unit_grid_eci[i][j],r_sun);
                 double cos_grid_view_sun = cos(grid_view_sun);
+                int alb_grid = alb && (cos_grid_view_sun>0);
                 
-                // For every satellite surface
-                for (int k=0; k<n_surf; k++){
+                if (alb_grid || ir){
                     
-                    // Rotate surface unit normal in ECI frame
-                    double surf_unit_eci[3];
-                    matxvec(C_b2i, geometry[k].normal, surf_unit_eci);
+                    // Grid direction in body frame
+                    double unit_grid_b[3];
+                    mat3_vec(C_i2b, unit_grid_eci[i][j], unit_grid_b);
                     
-                    // Check if surface is in view of Earth grid
-                    double grid_view_surf = vectors2angle(unit_grid_eci[i][j],surf_unit_eci);
-                    double cos_grid_view_surf = cos(grid_view_surf);
+                    // Force and torque of all surfaces in view of the grid per unit pressure
+                    double f_grid[3], g_grid[3], f_grid_ir[3], g_grid_ir[3];
+                    if (ft->n > 0){
+                        double fg[FACETS_RADIATION_N];
+                        facet_table_eval(ft, unit_grid_b, FACETS_DRAG_N, FACETS_RADIATION_N, fg);
+                        for (int l=0; l<3; l++){
+                            f_grid[l] = fg[l];
+                            g_grid[l] = fg[3+l];
+                            f_grid_ir[l] = fg[6+l];
+                            g_grid_ir[l] = fg[9+l];
+                        }
+                    }
+                    else
+                        facets_radiation(fa, unit_grid_b, alb_grid ? f_grid : NULL, g_grid, ir ? f_grid_ir : NULL, g_grid_ir);
                     
-                    // If surface is in view of Earth grid
-                    if (cos_grid_view_surf>0){
-                        
-                        // Optical properties
-                        double crd = geometry[k].crd;
-                        double crs = geometry[k].crs;
-                        double ca = geometry[k].ca;
+                    // IR force and torque from that grid
+                    if (ir){
                         
-                        // Optical properties
-                        double crd_ir = geometry[k].crd_ir;
-                        double crs_ir = geometry[k].crs_ir;
-                        double ca_ir = geometry[k].ca_ir;
+                        // Calculate flux
+                        double flux_ir = phi*albedo_interp[i][j][1]/1000.0*cos_grid_view_sat*grid_area[i]/(4*M_PI*grid_sat_dist*grid_sat_dist);
                         
-                        // Speed of light
-                        double c = 299792458.0;
-                        
-                        // Projected surface area
-                        double Ap = geometry[k].area*cos_grid_view_surf;
-                        
-                        // Calculate IR acceleration for that surface from that surface grid in ECI
-                        if (in_ir_a || in_ir_g){
-                            
-                            // Calculate flux
-                            double flux_ir = phi*albedo_interp[i][j][1]/1000.0*cos_grid_view_sat*grid_area[i]/(4*M_PI*grid_sat_dist*grid_sat_dist);
-                            
-                            // Calculate force on that surface
-                            f_surf[k][1][0] = f_surf[k][1][0] + flux_ir/c * Ap*((ca_ir+crd_ir)*unit_grid_eci[i][j][0] + (2*crd_ir/3.0 + 2*crs_ir*cos_grid_view_surf) *surf_unit_eci[0]);
-                            f_surf[k][1][1] = f_surf[k][1][1] + flux_ir/c * Ap*((ca_ir+crd_ir)*unit_grid_eci[i][j][1] + (2*crd_ir/3.0 + 2*crs_ir*cos_grid_view_surf) *surf_unit_eci[1]);
-                            f_surf[k][1][2] = f_surf[k][1][2] + flux_ir/c * Ap*((ca_ir+crd_ir)*unit_grid_eci[i][j][2] + (2*crd_ir/3.0 + 2*crs_ir*cos_grid_view_surf) *surf_unit_eci[2]);
+                        for (int l=0; l<3; l++){
+                            f_ir_b[l] = f_ir_b[l] + flux_ir/c*f_grid_ir[l];
+                            g_ir_b[l] = g_ir_b[l] + flux_ir/c*g_grid_ir[l];
                         }
+                    }
+                    
+                    // Albedo force and torque from that grid, if Earth grid is in view of sun
+                    if (alb_grid){
                         
-                        // If Earth grid is in view of sun
-                        if (cos_grid_view_sun>0){
-                            
-                            // Calculate albedo acceleration for that surface from that surface grid in ECI
-                            if (in_alb_a || in_alb_g){
-                                
-                                // Calculate flux
-                                double flux_alb = phi*albedo_interp[i][j][0]/1000.0*cos_grid_view_sat*cos_grid_view_sun*grid_area[i]/(M_PI*grid_sat_dist*grid_sat_dist);
-                                
-                                // Calculate force on that surface
-                                f_surf[k][0][0] = f_surf[k][0][0] + flux_alb/c * Ap*((ca+crd)*unit_grid_eci[i][j][0] + (2*crd/3.0 + 2*crs*cos_grid_view_surf) *surf_unit_eci[0]);
-                                f_surf[k][0][1] = f_surf[k][0][1] + flux_alb/c * Ap*((ca+crd)*unit_grid_eci[i][j][1] + (2*crd/3.0 + 2*crs*cos_grid_view_surf) *surf_unit_eci[1]);
-                                f_surf[k][0][2] = f_surf[k][0][2] + flux_alb/c * Ap*((ca+crd)*unit_grid_eci[i][j][2] + (2*crd/3.0 + 2*crs*cos_grid_view_surf) *surf_unit_eci[2]);
-                            }
+                        // Calculate flux
+                        double flux_alb = phi*albedo_interp[i][j][0]/1000.0*cos_grid_view_sat*cos_grid_view_sun*grid_area[i]/(M_PI*grid_sat_dist*grid_sat_dist);
+                        
+                        for (int l=0; l<3; l++){
+                            f_alb_b[l] = f_alb_b[l] + flux_alb/c*f_grid[l];
+                            g_alb_b[l] = g_alb_b[l] + flux_alb/c*g_grid[l];
                         }
                     }
                 }
@@ -286,63 +272,30 @@ void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_
         }
     }
     
-    // Calculate total IR acceleration
+    // Calculate total IR acceleration in inertial frame
     if (in_ir_a){
-        for (int k=0; k<n_surf; k++){
-            for (int i=0; i<3; i++){
-                a_ir[i] = a_ir[i]+f_surf[k][1][i]/m;
-            }
-        }
+        double f_ir[3];
+        mat3_vec(C_b2i, f_ir_b, f_ir);
+        for (int i=0; i<3; i++)
+            a_ir[i] = f_ir[i]/m;
     }
     
-    // Calculate total albedo acceleration
+    // Calculate total albedo acceleration in inertial frame
     if (in_alb_a){
-        for (int k=0; k<n_surf; k++){
-            for (int i=0; i<3; i++){
-                a_alb[i] = a_alb[i]+f_surf[k][0][i]/m;
-            }
-        }
-    }
-    
-    // Calculate center of pressure
-    double cp_b[n_surf][3];
-    for (int i=0; i<n_surf; i++){
-        cp_b[i][0] = (geometry[i].vertices[0][0] + geometry[i].vertices[0][1] + geometry[i].vertices[0][2])/3.0;
-        cp_b[i][1] = (geometry[i].vertices[1][0] + geometry[i].vertices[1][1] + geometry[i].vertices[1][2])/3.0;
-        cp_b[i][2] = (geometry[i].vertices[2][0] + geometry[i].vertices[2][1] + geometry[i].vertices[2][2])/3.0;
+        double f_alb[3];
+        mat3_vec(C_b2i, f_alb_b, f_alb);
+        for (int i=0; i<3; i++)
+            a_alb[i] = f_alb[i]/m;
     }
     
-    double g_surf[3], f_surf_body[3];
-    // Calculate IR torque for each surface in BODY
+    // Total IR and albedo torques in body frame
     if (in_ir_g){
-        for (int k=0; k<n_surf; k++){
-            
-            // Force in body frame
-            matxvec(C_i2b,f_surf[k][1],f_surf_body);
-            
-            // Calculate torque
-            crossprod(cp_b[k], f_surf_body, g_surf);
-            
-            for (int i=0; i<3; i++){
-                g_ir[i] = g_ir[i]+g_surf[i];
-            }
-        }
+        for (int i=0; i<3; i++)
+            g_ir[i] = g_ir_b[i];
     }
-    
-    // Calculate albedo torque for each surface in BODY
     if (in_alb_g){
-        for (int k=0; k<n_surf; k++){
-            
-            // Force in body frame
-            matxvec(C_i2b,f_surf[k][0],f_surf_body);
-            
-            // Calculate torque
-            crossprod(cp_b[k], f_surf_body, g_surf);
-            
-            for (int i=0; i<3; i++){
-                g_alb[i] = g_alb[i]+g_surf[i];
-            }
-        }
+        for (int i=0; i<3; i++)
+            g_alb[i] = g_alb_b[i];
     }
     
 }
@@ -10,7 +10,10 @@
 //%
 //% DESCRIPTION:          This function calculates the acceleration and
 //%                       torque due to reflected and emitted Earth radiation
-//%                       (See Section 2.3.3 in Sagnieres (2018) Doctoral Thesis)
+//%                       (See Section 2.3.3 in Sagnieres (2018) Doctoral Thesis).
+//%                       The force and torque of all surfaces are evaluated
+//%                       together in body frame for each Earth grid, or
+//%                       interpolated in the facet response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 July 2, 2018
@@ -32,8 +35,9 @@
 //%                         frame to TEME
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       double albedo[12][20][40][2]: albedo and IR coefficients
 //%                       int in_alb_a: inclusion of albedo acceleration?
@@ -51,11 +55,7 @@
 //%                         in body-fixed frame
 //%
 //% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - norm.c
-//%                       - crossprod.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//%                       - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -63,8 +63,9 @@
 #define albedo_calc_h
 
 #include <stdio.h>
-#include "surface.h"
+#include "facets.h"
+#include "facet_table.h"
 
-void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_sun[3], double C_ecef2teme[3][3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, double albedo[12][20][40][2], int in_alb_a, int in_alb_g, int in_ir_a, int in_ir_g, double a_alb[3], double g_alb[3], double a_ir[3], double g_ir[3]);
+void albedo_calc(double p[3], double v[3], double LLA[4], int time[3], double r_sun[3], double C_ecef2teme[3][3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, double albedo[12][20][40][2], int in_alb_a, int in_alb_g, int in_ir_a, int in_ir_g, double a_alb[3], double g_alb[3], double a_ir[3], double g_ir[3]);
 
 #endif /* albedo_calc_h */
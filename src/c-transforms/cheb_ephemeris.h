@@ -0,0 +1,70 @@
+//
+//  cheb_ephemeris.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_ephemeris.h
+//%
+//% DESCRIPTION:          This structure contains a Chebyshev-segment
+//%                       ephemeris (JPL DE style) of one body, memory-mapped
+//%                       from a binary file written by eph2cheb. The file is
+//%                       a 64-byte header (struct cheb_header) followed by
+//%                       n_seg*3*n_coef doubles, in the byte order of the
+//%                       machine that wrote it
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           double cheb_ephemeris.t_start: start of first
+//%                         segment (s since January 1, 2000, 00:00:00 TT)
+//%                       double cheb_ephemeris.t_end: end of last segment (s)
+//%                       double cheb_ephemeris.seg_len: segment length (s)
+//%                       int cheb_ephemeris.n_seg: number of segments
+//%                       int cheb_ephemeris.n_coef: coefficients per component
+//%                       const double *cheb_ephemeris.coef: coefficients
+//%                         [n_seg][3][n_coef] of the position (m) in the
+//%                         frame of the tabulated ephemeris
+//%                       void *cheb_ephemeris.map: mapped file (NULL if not
+//%                         loaded)
+//%                       size_t cheb_ephemeris.map_size: mapped size (bytes)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef cheb_ephemeris_h
+#define cheb_ephemeris_h
+
+#include <stddef.h>
+
+#define CHEB_MAGIC "DSPCHEB"
+#define CHEB_VERSION 1
+
+struct cheb_header
+{
+    char magic[8];
+    int version;
+    int n_seg;
+    int n_coef;
+    int n_comp;
+    double t_start;
+    double seg_len;
+    char reserved[24];
+};
+
+struct cheb_ephemeris
+{
+    double t_start;
+    double t_end;
+    double seg_len;
+    int n_seg;
+    int n_coef;
+    const double *coef;
+    
+    void *map;
+    size_t map_size;
+};
+
+#endif /* cheb_ephemeris_h */
@@ -0,0 +1,58 @@
+//
+//  cheb_eval.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_eval.c
+//%
+//% DESCRIPTION:          This function evaluates the position and velocity
+//%                       of a body from a Chebyshev-segment ephemeris
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct cheb_ephemeris *eph: ephemeris
+//%                       double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r[3]: position vector (m)
+//%                       double v[3]: velocity vector (m s-1) (not computed
+//%                         if NULL)
+//%
+//% COUPLING:             - cheb_series.c
+//%                       - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "cheb_eval.h"
+#include <math.h>
+#include <stdlib.h>
+#include "cheb_series.h"
+
+void cheb_eval(const struct cheb_ephemeris *eph, double t2000tt, double r[3], double v[3]){
+    
+    if (t2000tt < eph->t_start || t2000tt > eph->t_end){
+        fprintf(stderr, "\nError: epoch %.1f s is outside the Chebyshev ephemeris range (%.1f s to %.1f s)\n\n", t2000tt, eph->t_start, eph->t_end);
+        exit(-1);
+    }
+    
+    // Segment and normalized time within segment
+    int seg = (t2000tt - eph->t_start)/eph->seg_len;
+    if (seg >= eph->n_seg)
+        seg = eph->n_seg-1;
+    double tau = 2*(t2000tt - eph->t_start - seg*eph->seg_len)/eph->seg_len - 1;
+    
+    int n_coef = eph->n_coef;
+    const double (*coef)[n_coef] = (const double (*)[n_coef])(eph->coef + (size_t)seg*3*n_coef);
+    cheb_series(n_coef, 3, coef, tau, r, v);
+    
+    // d/dt = (2/seg_len) d/dtau
+    if (v != NULL){
+        for (int i=0; i<3; i++)
+            v[i] = v[i]*2/eph->seg_len;
+    }
+    
+}
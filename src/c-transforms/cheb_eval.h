@@ -0,0 +1,38 @@
+//
+//  cheb_eval.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_eval.c
+//%
+//% DESCRIPTION:          This function evaluates the position and velocity
+//%                       of a body from a Chebyshev-segment ephemeris
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct cheb_ephemeris *eph: ephemeris
+//%                       double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r[3]: position vector (m)
+//%                       double v[3]: velocity vector (m s-1) (not computed
+//%                         if NULL)
+//%
+//% COUPLING:             - cheb_series.c
+//%                       - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef cheb_eval_h
+#define cheb_eval_h
+
+#include <stdio.h>
+#include "cheb_ephemeris.h"
+
+void cheb_eval(const struct cheb_ephemeris *eph, double t2000tt, double r[3], double v[3]);
+
+#endif /* cheb_eval_h */
@@ -0,0 +1,88 @@
+//
+//  cheb_fit.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_fit.c
+//%
+//% DESCRIPTION:          This function fits Chebyshev series (one per
+//%                       component) to sampled values in the least-squares
+//%                       sense (modified Gram-Schmidt QR factorization)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_pts: number of samples (>= n_coef)
+//%                       double x[n_pts]: normalized sample arguments in [-1, 1]
+//%                       int n_comp: number of components
+//%                       double y[n_pts][n_comp]: sampled values
+//%                       int n_coef: number of coefficients per component
+//%
+//% OUTPUT:               double coef[n_comp][n_coef]: Chebyshev coefficients
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "cheb_fit.h"
+#include <math.h>
+#include <stdlib.h>
+
+void cheb_fit(int n_pts, double x[n_pts], int n_comp, double y[n_pts][n_comp], int n_coef, double coef[n_comp][n_coef]){
+    
+    if (n_pts < n_coef){
+        fprintf(stderr, "\nError in cheb_fit: %d samples cannot determine %d coefficients\n\n", n_pts, n_coef);
+        exit(-1);
+    }
+    
+    // Design matrix Q[j][k] = T_k(x_j), factorized in place as Q*R
+    double Q[n_pts][n_coef], R[n_coef][n_coef];
+    for (int j=0; j<n_pts; j++){
+        Q[j][0] = 1;
+        if (n_coef > 1)
+            Q[j][1] = x[j];
+        for (int k=2; k<n_coef; k++)
+            Q[j][k] = 2*x[j]*Q[j][k-1] - Q[j][k-2];
+    }
+    for (int k=0; k<n_coef; k++){
+        for (int i=0; i<n_coef; i++)
+            R[k][i] = 0;
+    }
+    for (int k=0; k<n_coef; k++){
+        double nrm = 0;
+        for (int j=0; j<n_pts; j++)
+            nrm = nrm + Q[j][k]*Q[j][k];
+        R[k][k] = sqrt(nrm);
+        for (int j=0; j<n_pts; j++)
+            Q[j][k] = Q[j][k]/R[k][k];
+        for (int i=k+1; i<n_coef; i++){
+            double d = 0;
+            for (int j=0; j<n_pts; j++)
+                d = d + Q[j][k]*Q[j][i];
+            R[k][i] = d;
+            for (int j=0; j<n_pts; j++)
+                Q[j][i] = Q[j][i] - d*Q[j][k];
+        }
+    }
+    
+    // Solve R*coef = Q'*y by back substitution
+    for (int c=0; c<n_comp; c++){
+        double b[n_coef];
+        for (int k=0; k<n_coef; k++){
+            b[k] = 0;
+            for (int j=0; j<n_pts; j++)
+                b[k] = b[k] + Q[j][k]*y[j][c];
+        }
+        for (int k=n_coef-1; k>=0; k--){
+            double s = b[k];
+            for (int i=k+1; i<n_coef; i++)
+                s = s - R[k][i]*coef[c][i];
+            coef[c][k] = s/R[k][k];
+        }
+    }
+    
+}
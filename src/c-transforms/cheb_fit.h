@@ -0,0 +1,38 @@
+//
+//  cheb_fit.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_fit.c
+//%
+//% DESCRIPTION:          This function fits Chebyshev series (one per
+//%                       component) to sampled values in the least-squares
+//%                       sense (modified Gram-Schmidt QR factorization)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_pts: number of samples (>= n_coef)
+//%                       double x[n_pts]: normalized sample arguments in [-1, 1]
+//%                       int n_comp: number of components
+//%                       double y[n_pts][n_comp]: sampled values
+//%                       int n_coef: number of coefficients per component
+//%
+//% OUTPUT:               double coef[n_comp][n_coef]: Chebyshev coefficients
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef cheb_fit_h
+#define cheb_fit_h
+
+#include <stdio.h>
+
+void cheb_fit(int n_pts, double x[n_pts], int n_comp, double y[n_pts][n_comp], int n_coef, double coef[n_comp][n_coef]);
+
+#endif /* cheb_fit_h */
@@ -0,0 +1,55 @@
+//
+//  cheb_series.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        cheb_series.c
+//%
+//% DESCRIPTION:          This function evaluates Chebyshev series (one per
+//%                       component) and their derivatives at a normalized
+//%                       argument with the Clenshaw recurrence
+//%                       b_k = c_k + 2*x*b_(k+1) - b_(k+2), f = c_0 + x*b_1 - b_2,
+//%                       and its derivative with respect to x for df
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_coef: number of coefficients per component
+//%                       int n_comp: number of components
+//%                       const double coef[n_comp][n_coef]: coefficients
+//%                       double x: normalized argument in [-1, 1]
+//%
+//% OUTPUT:               double f[n_comp]: value of each series
+//%                       double df[n_comp]: derivative with respect to x
+//%                         (not computed if NULL)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "cheb_series.h"
+
+void cheb_series(int n_coef, int n_comp, const double coef[n_comp][n_coef], double x, double f[n_comp], double *df){
+    
+    for (int i=0; i<n_comp; i++){
+        
+        // Backward recurrence from the highest degree, b_(n_coef) = b_(n_coef+1) = 0
+        double b1 = 0, b2 = 0, db1 = 0, db2 = 0;
+        for (int k=n_coef-1; k>=1; k--){
+            double b0 = coef[i][k] + 2*x*b1 - b2;
+            double db0 = 2*b1 + 2*x*db1 - db2;
+            b2 = b1;
+            b1 = b0;
+            db2 = db1;
+            db1 = db0;
+        }
+        f[i] = coef[i][0] + x*b1 - b2;
+        if (df != NULL)
+            df[i] = b1 + x*db1 - db2;
+    }
+    
+}
@@ -8,12 +8,18 @@
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //% FUNCTION NAME:        check_inputs.c
 //%
-//% DESCRIPTION:          This function will check the length of input files
+//% DESCRIPTION:          This function will check the length of input files.
+//%                       The Sun and Moon ephemeris tables are only read if
+//%                       the tabulated ephemeris model is selected and the
+//%                       body is needed; otherwise their length is set to 2
+//%                       and the tables are not loaded
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 February 11, 2016
 //% VERSION:              1
 //%
+//% INPUT:                double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%
 //% OUTPUT:               int length_of_file[5]
 //%                         - length_of_file[0]: length of file of 'ap_input.txt'
 //%                         - length_of_file[1]: length of file of 'solar_input.txt'
@@ -33,7 +39,7 @@
 
 extern int errno ;
 
-void check_inputs(int length_of_file[5]){
+void check_inputs(int length_of_file[5], double model_parameters[N_MODEL_PARAMETERS]){
     
     // Initialize parameters
     char skip[200];
@@ -101,40 +107,51 @@ void check_inputs(int length_of_file[5]){
     length_of_file[2] = length;
     fclose(fp);
     
-    // Check Sun Ephemeris
-    char loc_sun[400];
-    strcpy(loc_sun, loc_data);
-    fp = fopen(strcat(loc_sun,"sun_ephemeris.txt"),"r");
-    if (fp == NULL){
-        errnum = errno;
-        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_sun, strerror( errnum ));
-        exit(-1);
+    // Which ephemeris tables are needed?
+    int eph_model = model_parameters[27];
+    int need_sun = (eph_model == 1) && (model_parameters[5] || model_parameters[7] || model_parameters[8] || model_parameters[9] || model_parameters[10] || model_parameters[11] || model_parameters[12]);
+    int need_moon = (eph_model == 1) && model_parameters[6];
+    length_of_file[3] = 2;
+    length_of_file[4] = 2;
+    
+    if (need_sun){
+        // Check Sun Ephemeris
+        char loc_sun[400];
+        strcpy(loc_sun, loc_data);
+        fp = fopen(strcat(loc_sun,"sun_ephemeris.txt"),"r");
+        if (fp == NULL){
+            errnum = errno;
+            fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_sun, strerror( errnum ));
+            exit(-1);
+        }
+        for (int i = 0; i < 4; i++)
+            fgets(skip2, 400, fp);
+        n=0;
+        while (fscanf(fp,"%lf",&temp) != EOF)
+            n++;
+        length = n/7;
+        length_of_file[3] = length;
+        fclose(fp);
     }
-    for (int i = 0; i < 4; i++)
-        fgets(skip2, 400, fp);
-    n=0;
-    while (fscanf(fp,"%lf",&temp) != EOF)
-        n++;
-    length = n/7;
-    length_of_file[3] = length;
-    fclose(fp);
     
-    // Check Moon Ephemeris
-    char loc_moon[400];
-    strcpy(loc_moon, loc_data);
-    fp = fopen(strcat(loc_moon,"moon_ephemeris.txt"),"r");
-    if (fp == NULL){
-        errnum = errno;
-        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_moon, strerror( errnum ));
-        exit(-1);
+    if (need_moon){
+        // Check Moon Ephemeris
+        char loc_moon[400];
+        strcpy(loc_moon, loc_data);
+        fp = fopen(strcat(loc_moon,"moon_ephemeris.txt"),"r");
+        if (fp == NULL){
+            errnum = errno;
+            fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_moon, strerror( errnum ));
+            exit(-1);
+        }
+        for (int i = 0; i < 4; i++)
+            fgets(skip2, 400, fp);
+        n=0;
+        while (fscanf(fp,"%lf",&temp) != EOF)
+            n++;
+        length = n/7;
+        length_of_file[4] = length;
+        fclose(fp);
     }
-    for (int i = 0; i < 4; i++)
-        fgets(skip2, 400, fp);
-    n=0;
-    while (fscanf(fp,"%lf",&temp) != EOF)
-        n++;
-    length = n/7;
-    length_of_file[4] = length;
-    fclose(fp);
     
 }
@@ -8,12 +8,18 @@
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //% FUNCTION NAME:        check_inputs.c
 //%
-//% DESCRIPTION:          This function will check the length of input files
+//% DESCRIPTION:          This function will check the length of input files.
+//%                       The Sun and Moon ephemeris tables are only read if
+//%                       the tabulated ephemeris model is selected and the
+//%                       body is needed; otherwise their length is set to 2
+//%                       and the tables are not loaded
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 February 11, 2016
 //% VERSION:              1
 //%
+//% INPUT:                double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%
 //% OUTPUT:               int length_of_file[5]
 //%                         - length_of_file[0]: length of file of 'ap_input.txt'
 //%                         - length_of_file[1]: length of file of 'solar_input.txt'
@@ -29,7 +35,8 @@
 #define check_inputs_h
 
 #include <stdio.h>
+#include "load_model_parameters.h"
 
-void check_inputs(int length_of_file[5]);
+void check_inputs(int length_of_file[5], double model_parameters[N_MODEL_PARAMETERS]);
 
 #endif /* check_inputs_h */
@@ -0,0 +1,48 @@
+//
+//  date2days.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        date2days.c
+//%
+//% DESCRIPTION:          This function converts a Gregorian calendar date to
+//%                       the number of days since January 1, 2000 in closed
+//%                       form (years starting in March so that the leap day
+//%                       is the last day of the year, 400-year cycles)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int year
+//%                       int month: month (1 to 12)
+//%                       int day: day of month
+//%
+//% OUTPUT:               int days: days since January 1, 2000 (negative
+//%                         before)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "date2days.h"
+
+int date2days(int year, int month, int day){
+    
+    // Year starting on March 1
+    int y = year;
+    if (month <= 2)
+        y = y - 1;
+    int era = ((y >= 0) ? y : y-399)/400;   // 400-year cycle
+    int yoe = y - era*400;                  // year of cycle [0, 399]
+    int m = (month > 2) ? month-3 : month+9;
+    int doy = (153*m + 2)/5 + day-1;        // day of year from March 1 [0, 365]
+    int doe = yoe*365 + yoe/4 - yoe/100 + doy;  // day of cycle [0, 146096]
+    
+    // March 1, 0000 is 730425 days before January 1, 2000
+    return era*146097 + doe - 730425;
+    
+}
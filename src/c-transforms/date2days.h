@@ -0,0 +1,38 @@
+//
+//  date2days.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        date2days.c
+//%
+//% DESCRIPTION:          This function converts a Gregorian calendar date to
+//%                       the number of days since January 1, 2000 in closed
+//%                       form (years starting in March so that the leap day
+//%                       is the last day of the year, 400-year cycles)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int year
+//%                       int month: month (1 to 12)
+//%                       int day: day of month
+//%
+//% OUTPUT:               int days: days since January 1, 2000 (negative
+//%                         before)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef date2days_h
+#define date2days_h
+
+#include <stdio.h>
+
+int date2days(int year, int month, int day);
+
+#endif /* date2days_h */
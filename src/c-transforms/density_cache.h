@@ -0,0 +1,69 @@
+//
+//  density_cache.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_cache.h
+//%
+//% DESCRIPTION:          This structure contains the along-track density
+//%                       cache used by density_cached.c: the last model
+//%                       evaluation, its local altitude gradient, the
+//%                       adaptive reuse window and hit/error statistics
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           double density_cache.window_max: maximum reuse
+//%                         window (s), 0 to disable the cache
+//%                       double density_cache.tol: relative error bound
+//%                       double density_cache.window: current reuse window (s)
+//%                       int density_cache.valid: 0 if no node, 1 if the
+//%                         node has no along-track drift yet, 2 otherwise
+//%                       double density_cache.t: time of the node (s since
+//%                         January 1, 2000, 00:00:00 UTC)
+//%                       double density_cache.h: altitude of the node (km)
+//%                       double density_cache.log_rho: log of density at
+//%                         the node (log kg m-3)
+//%                       double density_cache.dlog_rho: altitude gradient
+//%                         of log density at the node (km-1)
+//%                       double density_cache.dlog_rho_dt: along-track rate
+//%                         of log density at the node (s-1)
+//%                       long density_cache.n_calls: number of requests
+//%                       long density_cache.n_hits: requests served by the fit
+//%                       long density_cache.n_checks: number of error checks
+//%                       double density_cache.err_max: maximum relative error
+//%                       double density_cache.err_sum: sum of relative errors
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_cache_h
+#define density_cache_h
+
+struct density_cache
+{
+    // Settings
+    double window_max;
+    double tol;
+    double window;
+    
+    // Fitted node
+    int valid;
+    double t;
+    double h;
+    double log_rho;
+    double dlog_rho;
+    double dlog_rho_dt;
+    
+    // Statistics
+    long n_calls;
+    long n_hits;
+    long n_checks;
+    double err_max;
+    double err_sum;
+};
+
+#endif /* density_cache_h */
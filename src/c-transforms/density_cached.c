@@ -0,0 +1,108 @@
+//
+//  density_cached.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_cached.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       at the satellite position, reusing a fit of the
+//%                       last model evaluation along the trajectory. The
+//%                       fit is log-linear in altitude (gradient from a
+//%                       second evaluation 1 km above the node) and in time
+//%                       along the track (drift between the last two nodes)
+//%                       and is used within a reuse window after the node;
+//%                       all integrator stages of a step share the step
+//%                       time. At each new node the prediction of the
+//%                       previous fit is compared with the model: the
+//%                       window is shrunk (by at least half, assuming a
+//%                       quadratic error growth) if the relative error
+//%                       exceeds the bound and grown by 1.5 (starting from
+//%                       the step size, up to its maximum) if it is below
+//%                       a quarter of it
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct density_cache *dc: density cache
+//%                       int atmos_model: which atmospheric model?
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct jb2008_cache *jc: JB2008 inputs of the last
+//%                         epoch
+//%                       double Apc: user-inputted Ap value
+//%                       double F107c: user-inputted F10.7 value
+//%
+//% OUTPUT:               double density: atmospheric density value at satellite
+//%                         position (kg m-3)
+//%
+//% COUPLING:             - get_density.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "density_cached.h"
+#include "get_density.h"
+#include <math.h>
+
+double density_cached(struct density_cache *dc, int atmos_model, double LLA[4], double t2000utc, const struct space_weather *sw, struct jb2008_cache *jc, double Apc, double F107c){
+    
+    // Cache disabled
+    if (dc->window_max<=0)
+        return get_density(atmos_model, LLA, t2000utc, sw, jc, Apc, F107c);
+    
+    dc->n_calls++;
+    
+    // Within the reuse window of the node (only at the node time until
+    // the along-track drift is known): evaluate the fit
+    double dt = t2000utc - dc->t;
+    if ((dc->valid)&&(dt>=0)&&((dt==0)||((dc->valid==2)&&(dt<=dc->window)))){
+        dc->n_hits++;
+        return exp(dc->log_rho + dc->dlog_rho*(LLA[3]-dc->h) + dc->dlog_rho_dt*dt);
+    }
+    
+    // New node: density and its altitude gradient (1 km step)
+    double dh = 1.0;
+    double LLA_dh[4] = {LLA[0], LLA[1], LLA[2], LLA[3]+dh};
+    double density = get_density(atmos_model, LLA, t2000utc, sw, jc, Apc, F107c);
+    double density_dh = get_density(atmos_model, LLA_dh, t2000utc, sw, jc, Apc, F107c);
+    
+    // Error of the previous fit at the new node and window update
+    double log_rho_h = dc->log_rho + dc->dlog_rho*(LLA[3]-dc->h);
+    if ((dc->valid==2)&&(dt>=0)){
+        double err = fabs(exp(log_rho_h + dc->dlog_rho_dt*dt - log(density)) - 1);
+        dc->n_checks++;
+        dc->err_sum = dc->err_sum + err;
+        if (err>dc->err_max)
+            dc->err_max = err;
+        if (err>dc->tol)
+            dc->window = fmin(0.5, sqrt(dc->tol/err))*dc->window;
+        else if (err<0.25*dc->tol)
+            dc->window = fmin(fmax(1.5*dc->window, dt), dc->window_max);
+    }
+    
+    // Along-track drift since the previous node
+    if ((dc->valid)&&(dt>0)){
+        dc->dlog_rho_dt = (log(density) - log_rho_h)/dt;
+        dc->valid = 2;
+    }
+    else {
+        dc->dlog_rho_dt = 0;
+        dc->valid = 1;
+    }
+    
+    dc->t = t2000utc;
+    dc->h = LLA[3];
+    dc->log_rho = log(density);
+    dc->dlog_rho = (log(density_dh) - dc->log_rho)/dh;
+    
+    return density;
+}
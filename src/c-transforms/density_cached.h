@@ -0,0 +1,62 @@
+//
+//  density_cached.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_cached.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       at the satellite position, reusing a fit of the
+//%                       last model evaluation along the trajectory. The
+//%                       fit is log-linear in altitude (gradient from a
+//%                       second evaluation 1 km above the node) and in time
+//%                       along the track (drift between the last two nodes)
+//%                       and is used within a reuse window after the node;
+//%                       all integrator stages of a step share the step
+//%                       time. At each new node the prediction of the
+//%                       previous fit is compared with the model: the
+//%                       window is shrunk (by at least half, assuming a
+//%                       quadratic error growth) if the relative error
+//%                       exceeds the bound and grown by 1.5 (starting from
+//%                       the step size, up to its maximum) if it is below
+//%                       a quarter of it
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct density_cache *dc: density cache
+//%                       int atmos_model: which atmospheric model?
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct jb2008_cache *jc: JB2008 inputs of the last
+//%                         epoch
+//%                       double Apc: user-inputted Ap value
+//%                       double F107c: user-inputted F10.7 value
+//%
+//% OUTPUT:               double density: atmospheric density value at satellite
+//%                         position (kg m-3)
+//%
+//% COUPLING:             - get_density.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_cached_h
+#define density_cached_h
+
+#include <stdio.h>
+#include "space_weather.h"
+#include "density_cache.h"
+#include "jb2008_cache.h"
+
+double density_cached(struct density_cache *dc, int atmos_model, double LLA[4], double t2000utc, const struct space_weather *sw, struct jb2008_cache *jc, double Apc, double F107c);
+
+#endif /* density_cached_h */
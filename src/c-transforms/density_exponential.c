@@ -0,0 +1,72 @@
+//
+//  density_exponential.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_exponential.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       from the piecewise-exponential model (CIRA-72
+//%                       based reference densities and scale heights, see
+//%                       Vallado (2013) Table 8-4). It depends on altitude
+//%                       only
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double alt: altitude (km)
+//%
+//% OUTPUT:               double density: atmospheric density (kg m-3)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "density_exponential.h"
+#include <math.h>
+
+double density_exponential(double alt){
+    
+    // Base altitude (km), nominal density (kg m-3) and scale height (km)
+    static const double table[28][3] = {
+        {   0, 1.225,       7.249},
+        {  25, 3.899e-2,    6.349},
+        {  30, 1.774e-2,    6.682},
+        {  40, 3.972e-3,    7.554},
+        {  50, 1.057e-3,    8.382},
+        {  60, 3.206e-4,    7.714},
+        {  70, 8.770e-5,    6.549},
+        {  80, 1.905e-5,    5.799},
+        {  90, 3.396e-6,    5.382},
+        { 100, 5.297e-7,    5.877},
+        { 110, 9.661e-8,    7.263},
+        { 120, 2.438e-8,    9.473},
+        { 130, 8.484e-9,   12.636},
+        { 140, 3.845e-9,   16.149},
+        { 150, 2.070e-9,   22.523},
+        { 180, 5.464e-10,  29.740},
+        { 200, 2.789e-10,  37.105},
+        { 250, 7.248e-11,  45.546},
+        { 300, 2.418e-11,  53.628},
+        { 350, 9.518e-12,  53.298},
+        { 400, 3.725e-12,  58.515},
+        { 450, 1.585e-12,  60.828},
+        { 500, 6.967e-13,  63.822},
+        { 600, 1.454e-13,  71.835},
+        { 700, 3.614e-14,  88.667},
+        { 800, 1.170e-14,  124.64},
+        { 900, 5.245e-15,  181.05},
+        {1000, 3.019e-15,  268.00}
+    };
+    
+    // Band containing the altitude (the first band below 0 km, the last above 1000 km)
+    int i = 27;
+    while ((i > 0) && (alt < table[i][0]))
+        i--;
+    
+    return table[i][1]*exp(-(alt - table[i][0])/table[i][2]);
+}
@@ -0,0 +1,36 @@
+//
+//  density_exponential.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_exponential.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       from the piecewise-exponential model (CIRA-72
+//%                       based reference densities and scale heights, see
+//%                       Vallado (2013) Table 8-4). It depends on altitude
+//%                       only
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double alt: altitude (km)
+//%
+//% OUTPUT:               double density: atmospheric density (kg m-3)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_exponential_h
+#define density_exponential_h
+
+#include <stdio.h>
+
+double density_exponential(double alt);
+
+#endif /* density_exponential_h */
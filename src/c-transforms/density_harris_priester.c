@@ -0,0 +1,132 @@
+//
+//  density_harris_priester.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_harris_priester.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       from the Harris-Priester model with the diurnal
+//%                       bulge (mean solar activity coefficients, see
+//%                       Montenbruck and Gill (2000) Section 3.5.2). The
+//%                       bulge apex lags the Sun by 30 deg in right
+//%                       ascension; the Sun position is from
+//%                       sun_analytic.c. The density is 0 outside 100-1000 km
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double density: atmospheric density (kg m-3)
+//%
+//% COUPLING:             - sun_analytic.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "density_harris_priester.h"
+#include "sun_analytic.h"
+#include <math.h>
+
+double density_harris_priester(double LLA[4], double t2000utc){
+    
+    // Altitude (km), minimum and maximum density (g km-3)
+    static const double table[50][3] = {
+        { 100, 497400.0,  497400.0},
+        { 120,  24900.0,   24900.0},
+        { 130,   8377.0,    8710.0},
+        { 140,   3899.0,    4059.0},
+        { 150,   2122.0,    2215.0},
+        { 160,   1263.0,    1344.0},
+        { 170,   800.8,     875.8},
+        { 180,   528.3,     601.0},
+        { 190,   361.7,     429.7},
+        { 200,   255.7,     316.2},
+        { 210,   183.9,     239.6},
+        { 220,   134.1,     185.3},
+        { 230,   99.49,     145.5},
+        { 240,   74.88,     115.7},
+        { 250,   57.09,     93.08},
+        { 260,   44.03,     75.55},
+        { 270,   34.30,     61.82},
+        { 280,   26.97,     50.95},
+        { 290,   21.39,     42.26},
+        { 300,   17.08,     35.26},
+        { 320,   10.99,     25.11},
+        { 340,   7.214,     18.19},
+        { 360,   4.824,     13.37},
+        { 380,   3.274,     9.955},
+        { 400,   2.249,     7.492},
+        { 420,   1.558,     5.684},
+        { 440,   1.091,     4.355},
+        { 460,   0.7701,    3.362},
+        { 480,   0.5474,    2.612},
+        { 500,   0.3916,    2.042},
+        { 520,   0.2819,    1.605},
+        { 540,   0.2042,    1.267},
+        { 560,   0.1488,    1.005},
+        { 580,   0.1092,    0.7997},
+        { 600,   0.08070,   0.6390},
+        { 620,   0.06012,   0.5123},
+        { 640,   0.04519,   0.4121},
+        { 660,   0.03430,   0.3325},
+        { 680,   0.02632,   0.2691},
+        { 700,   0.02043,   0.2185},
+        { 720,   0.01607,   0.1779},
+        { 740,   0.01281,   0.1452},
+        { 760,   0.01036,   0.1190},
+        { 780,   0.008496,  0.09776},
+        { 800,   0.007069,  0.08059},
+        { 840,   0.004680,  0.05741},
+        { 880,   0.003200,  0.04210},
+        { 920,   0.002210,  0.03130},
+        { 960,   0.001560,  0.02360},
+        {1000,   0.001150,  0.01810}
+    };
+    
+    // Cosine exponent: 2 for low-inclination orbits (6 for polar orbits)
+    double n_prm = 2;
+    
+    double alt = LLA[3];
+    if ((alt < table[0][0]) || (alt > table[49][0]))
+        return 0;
+    
+    // Sun right ascension and declination (the Sun moves ~0.04 deg per
+    // minute, so UTC is used for TT)
+    double r_sun[3];
+    sun_analytic(t2000utc, r_sun);
+    double ra_sun = atan2(r_sun[1], r_sun[0]);
+    double dec_sun = atan2(r_sun[2], sqrt(r_sun[0]*r_sun[0] + r_sun[1]*r_sun[1]));
+    
+    // Greenwich mean sidereal time (as in teme2ecef.c, UT1 = UTC)
+    double tut1 = (t2000utc-(12*60*60.0))/(60*60*24*36525.0);
+    double gmst = - 6.2e-6 * tut1 * tut1 * tut1 + 0.093104 * tut1 * tut1 + (876600.0 * 3600.0 + 8640184.812866) * tut1 + 67310.54841;
+    gmst = fmod( gmst*M_PI/180.0/240.0, 2*M_PI );
+    
+    // Angle between the satellite and the bulge apex
+    double lag = 30*M_PI/180.0;
+    double cos_psi = sin(LLA[0])*sin(dec_sun) + cos(LLA[0])*cos(dec_sun)*cos(gmst + LLA[2] - ra_sun - lag);
+    
+    // Exponential interpolation of minimum and maximum densities
+    int i = 0;
+    while ((i < 48) && (alt >= table[i+1][0]))
+        i++;
+    double h_min = (table[i][0] - table[i+1][0])/log(table[i+1][1]/table[i][1]);
+    double h_max = (table[i][0] - table[i+1][0])/log(table[i+1][2]/table[i][2]);
+    double d_min = table[i][1]*exp((table[i][0] - alt)/h_min);
+    double d_max = table[i][2]*exp((table[i][0] - alt)/h_max);
+    
+    // Diurnal bulge, g km-3 to kg m-3
+    double density = d_min + (d_max - d_min)*pow(0.5 + 0.5*cos_psi, n_prm/2);
+    
+    return density*1e-12;
+}
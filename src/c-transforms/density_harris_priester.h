@@ -0,0 +1,43 @@
+//
+//  density_harris_priester.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_harris_priester.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       from the Harris-Priester model with the diurnal
+//%                       bulge (mean solar activity coefficients, see
+//%                       Montenbruck and Gill (2000) Section 3.5.2). The
+//%                       bulge apex lags the Sun by 30 deg in right
+//%                       ascension; the Sun position is from
+//%                       sun_analytic.c. The density is 0 outside 100-1000 km
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double density: atmospheric density (kg m-3)
+//%
+//% COUPLING:             - sun_analytic.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_harris_priester_h
+#define density_harris_priester_h
+
+#include <stdio.h>
+
+double density_harris_priester(double LLA[4], double t2000utc);
+
+#endif /* density_harris_priester_h */
@@ -0,0 +1,78 @@
+//
+//  density_table.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_table.h
+//%
+//% DESCRIPTION:          This structure contains a precomputed NRLMSISE-00
+//%                       density table for constant Ap and F10.7,
+//%                       memory-mapped read-only from a binary file written
+//%                       by msis2tab (so it is shared between processes).
+//%                       The file is a 160-byte header (struct
+//%                       density_table_header) followed by the natural log
+//%                       of density (kg m-3) as floats
+//%                       [n_doy][n_lst][n_lon][n_lat][n_alt] on a regular
+//%                       grid, periodic in longitude, local solar time and
+//%                       day of year, in the byte order of the machine that
+//%                       wrote it
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           double density_table.Ap: constant Ap of the table
+//%                       double density_table.F107: constant F10.7 of the table
+//%                       int density_table.n[5]: number of altitude,
+//%                         latitude, longitude, local solar time and day of
+//%                         year nodes
+//%                       double density_table.x0[5]: first altitude (km),
+//%                         geodetic latitude (deg), longitude (deg), local
+//%                         solar time (h) and day of year
+//%                       double density_table.dx[5]: node spacings
+//%                       const float *density_table.log_rho: log density
+//%                       void *density_table.map: mapped file (NULL if not
+//%                         loaded)
+//%                       size_t density_table.map_size: mapped size (bytes)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_table_h
+#define density_table_h
+
+#include <stddef.h>
+
+#define DENSITY_TABLE_MAGIC "DSPDENS"
+#define DENSITY_TABLE_VERSION 1
+
+struct density_table_header
+{
+    char magic[8];
+    int version;
+    int atmos_model;
+    int n_dim;
+    int n[5];
+    double Ap;
+    double F107;
+    double x0[5];
+    double dx[5];
+    char reserved[24];
+};
+
+struct density_table
+{
+    double Ap;
+    double F107;
+    int n[5];
+    double x0[5];
+    double dx[5];
+    const float *log_rho;
+    
+    void *map;
+    size_t map_size;
+};
+
+#endif /* density_table_h */
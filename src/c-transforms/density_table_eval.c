@@ -0,0 +1,101 @@
+//
+//  density_table_eval.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_table_eval.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       at the satellite position by multilinear
+//%                       interpolation of the log density in a precomputed
+//%                       table (altitude, geodetic latitude, longitude,
+//%                       local solar time, day of year). The table is only
+//%                       read, so it can be shared between threads
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct density_table *tab: density table
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double *density: atmospheric density value at
+//%                         satellite position (kg m-3)
+//%                       int density_table_eval: 1 if the altitude is
+//%                         within the table, 0 otherwise (density unchanged)
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "density_table_eval.h"
+#include "t2doy.h"
+#include <math.h>
+
+int density_table_eval(const struct density_table *tab, double LLA[4], double t2000utc, double *density){
+    
+    // Day of year and local solar time as in get_density.c
+    int time[3];
+    double sec = t2doy(t2000utc, time);
+    double lst = fmod(sec/3600.0 + LLA[2]*12/M_PI, 24.0);
+    if (lst < 0)
+        lst = lst + 24.0;
+    double x[5] = {LLA[3], LLA[1]*180/M_PI, LLA[2]*180/M_PI, lst, time[1]};
+    
+    // Cell index and weight per dimension (periodic in longitude, local
+    // time and day)
+    int k[5][2];
+    double w[5];
+    for (int i=0; i<5; i++){
+        double u = (x[i] - tab->x0[i])/tab->dx[i];
+        int n = tab->n[i];
+        if (i < 2){
+            if (u < 0 || u > n-1){
+                if (i == 0)
+                    return 0;
+                u = (u < 0) ? 0 : n-1;
+            }
+            int j = (int)floor(u);
+            if (j > n-2)
+                j = n-2;
+            k[i][0] = j;
+            k[i][1] = j+1;
+            w[i] = u - j;
+        }
+        else {
+            u = fmod(u, n);
+            if (u < 0)
+                u = u + n;
+            int j = (int)floor(u);
+            if (j > n-1)
+                j = n-1;
+            k[i][0] = j;
+            k[i][1] = (j+1) % n;
+            w[i] = u - j;
+        }
+    }
+    
+    // Multilinear interpolation of log density over the 32 cell corners
+    double log_rho = 0;
+    for (int c=0; c<32; c++){
+        double wc = 1;
+        size_t idx = 0;
+        for (int i=4; i>=0; i--){
+            int b = (c >> i) & 1;
+            wc = wc*(b ? w[i] : 1-w[i]);
+            idx = idx*tab->n[i] + k[i][b];
+        }
+        log_rho = log_rho + wc*tab->log_rho[idx];
+    }
+    *density = exp(log_rho);
+    
+    return 1;
+}
@@ -0,0 +1,47 @@
+//
+//  density_table_eval.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        density_table_eval.c
+//%
+//% DESCRIPTION:          This function will obtain the atmospheric density
+//%                       at the satellite position by multilinear
+//%                       interpolation of the log density in a precomputed
+//%                       table (altitude, geodetic latitude, local solar
+//%                       time, day of year). The table is only read, so it
+//%                       can be shared between threads
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct density_table *tab: density table
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double *density: atmospheric density value at
+//%                         satellite position (kg m-3)
+//%                       int density_table_eval: 1 if the altitude is
+//%                         within the table, 0 otherwise (density unchanged)
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef density_table_eval_h
+#define density_table_eval_h
+
+#include <stdio.h>
+#include "density_table.h"
+
+int density_table_eval(const struct density_table *tab, double LLA[4], double t2000utc, double *density);
+
+#endif /* density_table_eval_h */
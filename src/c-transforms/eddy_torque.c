@@ -25,23 +25,21 @@
 //%
 //% OUTPUT:               double g_eddy[3]: eddy_current torque
 //%
-//% COUPLING:             - crossprod.c
-//%                       - matxvec.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "eddy_torque.h"
-#include "crossprod.h"
-#include "matxvec.h"
+#include "linalg.h"
 
 void eddy_torque(double B_field_b[3], double B_field_dot_b[3], double w[3], double M[3][3], double g_eddy[3]){
     
     double wxB[3], MwxB[3];
-    crossprod(w,B_field_b,wxB);
+    vec3_cross(w,B_field_b,wxB);
     double Bdiff[3];
     for (int i=0; i<3; i++)
         Bdiff[i] = wxB[i]-B_field_dot_b[i];
-    matxvec(M,Bdiff,MwxB);
-    crossprod(MwxB,B_field_b,g_eddy);
+    mat3_vec(M,Bdiff,MwxB);
+    vec3_cross(MwxB,B_field_b,g_eddy);
     
 }
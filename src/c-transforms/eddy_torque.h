@@ -25,8 +25,7 @@
 //%
 //% OUTPUT:               double g_eddy[3]: eddy_current torque
 //%
-//% COUPLING:             - crossprod.c
-//%                       - matxvec.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
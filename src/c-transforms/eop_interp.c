@@ -0,0 +1,71 @@
+//
+//  eop_interp.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        eop_interp.c
+//%
+//% DESCRIPTION:          This function interpolates the daily Earth
+//%                       orientation parameters (eop.txt, 0h UTC values)
+//%                       linearly to an epoch. The 1 s jump of UT1-UTC at a
+//%                       leap second is removed from the interpolation.
+//%                       Epochs outside the file use the first or last
+//%                       values
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double eop_t[4]:
+//%                         - eop_t[0]: polar motion xp (rad)
+//%                         - eop_t[1]: polar motion yp (rad)
+//%                         - eop_t[2]: UT1-UTC (s)
+//%                         - eop_t[3]: length of day (s)
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "eop_interp.h"
+#include <math.h>
+#include "t2doy.h"
+
+void eop_interp(int n_eop, double eop[n_eop][10], double t2000utc, double eop_t[4]){
+    
+    // Row of the day (eop.txt starts on January 1, 2000) and fraction of day
+    int time[3];
+    double sec = t2doy(t2000utc, time);
+    int i = time[2]-1;
+    double f = sec/(24*60*60.0);
+    if (i < 0){
+        i = 0;
+        f = 0;
+    }
+    if (i > n_eop-2){
+        i = n_eop-2;
+        f = 1;
+    }
+    
+    // Polar motion (arcsec to rad)
+    eop_t[0] = (eop[i][4] + f*(eop[i+1][4]-eop[i][4]))*M_PI/(648000.0);
+    eop_t[1] = (eop[i][5] + f*(eop[i+1][5]-eop[i][5]))*M_PI/(648000.0);
+    
+    // UT1-UTC without the leap second jump
+    double d_dut1 = eop[i+1][6]-eop[i][6];
+    if (d_dut1 > 0.5)
+        d_dut1 = d_dut1 - 1;
+    else if (d_dut1 < -0.5)
+        d_dut1 = d_dut1 + 1;
+    eop_t[2] = eop[i][6] + f*d_dut1;
+    
+    // Length of day
+    eop_t[3] = eop[i][7] + f*(eop[i+1][7]-eop[i][7]);
+    
+}
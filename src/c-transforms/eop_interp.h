@@ -0,0 +1,43 @@
+//
+//  eop_interp.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        eop_interp.c
+//%
+//% DESCRIPTION:          This function interpolates the daily Earth
+//%                       orientation parameters (eop.txt, 0h UTC values)
+//%                       linearly to an epoch. The 1 s jump of UT1-UTC at a
+//%                       leap second is removed from the interpolation.
+//%                       Epochs outside the file use the first or last
+//%                       values
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double eop_t[4]:
+//%                         - eop_t[0]: polar motion xp (rad)
+//%                         - eop_t[1]: polar motion yp (rad)
+//%                         - eop_t[2]: UT1-UTC (s)
+//%                         - eop_t[3]: length of day (s)
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef eop_interp_h
+#define eop_interp_h
+
+#include <stdio.h>
+
+void eop_interp(int n_eop, double eop[n_eop][10], double t2000utc, double eop_t[4]);
+
+#endif /* eop_interp_h */
@@ -0,0 +1,84 @@
+//
+//  facet_bvh.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_bvh.h
+//%
+//% DESCRIPTION:          This structure contains a bounding-volume hierarchy
+//%                       (axis-aligned boxes) over the triangles of the
+//%                       surface geometry model, the sample points of each
+//%                       surface used for self-shadowing, and the visible
+//%                       fractions of the surfaces cached per flux direction
+//%                       on the cells of a cube map (see facet_table.h)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int facet_bvh.n_surf: number of surfaces
+//%                       int facet_bvh.n_nodes: number of nodes
+//%                       double *facet_bvh.bmin, *bmax: [n_nodes][3] corners
+//%                         of the node boxes (m)
+//%                       int *facet_bvh.right: index of the second child of
+//%                         an inner node (the first child follows the node)
+//%                       int *facet_bvh.first, *count: triangles of a leaf
+//%                         (count is 0 for inner nodes)
+//%                       int *facet_bvh.id: surface index of the triangles
+//%                         in hierarchy order
+//%                       double *facet_bvh.v0, *e1, *e2: [n_surf][3] first
+//%                         vertex and edges of the triangles in hierarchy
+//%                         order (m)
+//%                       double facet_bvh.eps: minimum distance of an
+//%                         occluder along a ray (m)
+//%                       int facet_bvh.n_samples: sample points per surface
+//%                       double *facet_bvh.samples: [n_surf][n_samples][3]
+//%                         sample points (m)
+//%                       int facet_bvh.n_cache: cache cells per cube face
+//%                         edge, 0 to cast the rays at every call
+//%                       double **facet_bvh.cache: [6*n_cache*n_cache]
+//%                         visible fractions of the surfaces for the
+//%                         direction of the center of a cell, NULL until
+//%                         the cell is first requested
+//%                       long facet_bvh.n_calls: number of requests
+//%                       long facet_bvh.n_rays: number of rays cast
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_bvh_h
+#define facet_bvh_h
+
+// Maximum number of triangles in a leaf
+#define FACET_BVH_LEAF 4
+
+struct facet_bvh
+{
+    int n_surf;
+    
+    // Hierarchy
+    int n_nodes;
+    double *bmin, *bmax;
+    int *right;
+    int *first, *count;
+    
+    // Triangles
+    int *id;
+    double *v0, *e1, *e2;
+    double eps;
+    
+    // Sample points
+    int n_samples;
+    double *samples;
+    
+    // Visibility cache
+    int n_cache;
+    double **cache;
+    
+    long n_calls;
+    long n_rays;
+};
+
+#endif /* facet_bvh_h */
@@ -0,0 +1,197 @@
+//
+//  facet_bvh_build.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_bvh_build.c
+//%
+//% DESCRIPTION:          This function builds the bounding-volume hierarchy
+//%                       of the surface geometry model used for
+//%                       self-shadowing. Nodes are split in two halves along
+//%                       the longest extent of the triangle centroids, down
+//%                       to FACET_BVH_LEAF triangles. Each surface is
+//%                       sampled at the centroids of the n_sub x n_sub
+//%                       triangles of its regular subdivision
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_surf: number of surfaces in geometry model
+//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       int n_sub: sample points per surface edge
+//%                       int n_cache: visibility cache cells per cube face
+//%                         edge, 0 to cast the rays at every call
+//%
+//% OUTPUT:               struct facet_bvh *bvh: bounding-volume hierarchy
+//%
+//% COUPLING:             - surface.h
+//%                       - facet_bvh.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facet_bvh_build.h"
+#include <stdlib.h>
+#include <math.h>
+#include "surface.h"
+#include "facet_bvh.h"
+
+// Partial sort of order[lo..hi] along an axis so that order[k] is in place
+// (quickselect)
+static void select_median(const double *centroid, int axis, int *order, int lo, int hi, int k){
+    
+    while (lo < hi){
+        double pivot = centroid[3*order[(lo+hi)/2]+axis];
+        int i = lo, j = hi;
+        while (i <= j){
+            while (centroid[3*order[i]+axis] < pivot)
+                i++;
+            while (centroid[3*order[j]+axis] > pivot)
+                j--;
+            if (i <= j){
+                int tmp = order[i];
+                order[i] = order[j];
+                order[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j)
+            hi = j;
+        else if (k >= i)
+            lo = i;
+        else
+            return;
+    }
+}
+
+// Build the node covering triangles order[first..first+count-1], return its index
+static int build_node(struct facet_bvh *bvh, int n_surf, struct surface geometry[n_surf], const double *centroid, int *order, int first, int count){
+    
+    int node = bvh->n_nodes;
+    bvh->n_nodes++;
+    
+    // Box of the triangles and of their centroids
+    double cmin[3], cmax[3];
+    for (int k=0; k<3; k++){
+        bvh->bmin[3*node+k] = INFINITY;
+        bvh->bmax[3*node+k] = -INFINITY;
+        cmin[k] = INFINITY;
+        cmax[k] = -INFINITY;
+    }
+    for (int i=first; i<first+count; i++){
+        int t = order[i];
+        for (int k=0; k<3; k++){
+            for (int l=0; l<3; l++){
+                bvh->bmin[3*node+k] = fmin(bvh->bmin[3*node+k], geometry[t].vertices[k][l]);
+                bvh->bmax[3*node+k] = fmax(bvh->bmax[3*node+k], geometry[t].vertices[k][l]);
+            }
+            cmin[k] = fmin(cmin[k], centroid[3*t+k]);
+            cmax[k] = fmax(cmax[k], centroid[3*t+k]);
+        }
+    }
+    
+    // Leaf
+    if (count <= FACET_BVH_LEAF){
+        bvh->first[node] = first;
+        bvh->count[node] = count;
+        bvh->right[node] = -1;
+        return node;
+    }
+    
+    // Split in two halves along the longest extent of the centroids
+    int axis = 0;
+    for (int k=1; k<3; k++){
+        if (cmax[k]-cmin[k] > cmax[axis]-cmin[axis])
+            axis = k;
+    }
+    int mid = first + count/2;
+    select_median(centroid, axis, order, first, first+count-1, mid);
+    
+    bvh->first[node] = first;
+    bvh->count[node] = 0;
+    build_node(bvh, n_surf, geometry, centroid, order, first, mid-first);
+    bvh->right[node] = build_node(bvh, n_surf, geometry, centroid, order, mid, first+count-mid);
+    return node;
+}
+
+void facet_bvh_build(int n_surf, struct surface geometry[n_surf], int n_sub, int n_cache, struct facet_bvh *bvh){
+    
+    int n_max = (n_surf > 0) ? 2*n_surf-1 : 1;
+    bvh->n_surf = n_surf;
+    bvh->n_nodes = 0;
+    bvh->bmin = malloc(3*n_max*sizeof(double));
+    bvh->bmax = malloc(3*n_max*sizeof(double));
+    bvh->right = malloc(n_max*sizeof(int));
+    bvh->first = malloc(n_max*sizeof(int));
+    bvh->count = malloc(n_max*sizeof(int));
+    bvh->id = malloc((n_surf+1)*sizeof(int));
+    bvh->v0 = malloc(3*(n_surf+1)*sizeof(double));
+    bvh->e1 = malloc(3*(n_surf+1)*sizeof(double));
+    bvh->e2 = malloc(3*(n_surf+1)*sizeof(double));
+    bvh->n_samples = n_sub*n_sub;
+    bvh->samples = malloc(3*(size_t)(n_surf+1)*bvh->n_samples*sizeof(double));
+    bvh->n_cache = n_cache;
+    bvh->cache = calloc(6*n_cache*n_cache+1, sizeof(double *));
+    double *centroid = malloc(3*(n_surf+1)*sizeof(double));
+    if ((bvh->bmin == NULL)||(bvh->bmax == NULL)||(bvh->right == NULL)||(bvh->first == NULL)||(bvh->count == NULL)||(bvh->id == NULL)||(bvh->v0 == NULL)||(bvh->e1 == NULL)||(bvh->e2 == NULL)||(bvh->samples == NULL)||(bvh->cache == NULL)||(centroid == NULL)){
+        fprintf(stderr, "Error in 'facet_bvh_build.c': Could not allocate bounding-volume hierarchy\n");
+        exit(-1);
+    }
+    bvh->n_calls = 0;
+    bvh->n_rays = 0;
+    
+    // Centroids and size of the geometry
+    double gmin[3] = {INFINITY,INFINITY,INFINITY}, gmax[3] = {-INFINITY,-INFINITY,-INFINITY};
+    for (int i=0; i<n_surf; i++){
+        bvh->id[i] = i;
+        for (int k=0; k<3; k++){
+            centroid[3*i+k] = (geometry[i].vertices[k][0] + geometry[i].vertices[k][1] + geometry[i].vertices[k][2])/3.0;
+            for (int l=0; l<3; l++){
+                gmin[k] = fmin(gmin[k], geometry[i].vertices[k][l]);
+                gmax[k] = fmax(gmax[k], geometry[i].vertices[k][l]);
+            }
+        }
+    }
+    double diag = 0;
+    for (int k=0; k<3; k++)
+        diag = diag + (gmax[k]-gmin[k])*(gmax[k]-gmin[k]);
+    bvh->eps = 1e-9*sqrt(diag);
+    
+    // Hierarchy and triangles in hierarchy order
+    if (n_surf > 0)
+        build_node(bvh, n_surf, geometry, centroid, bvh->id, 0, n_surf);
+    for (int i=0; i<n_surf; i++){
+        int t = bvh->id[i];
+        for (int k=0; k<3; k++){
+            bvh->v0[3*i+k] = geometry[t].vertices[k][0];
+            bvh->e1[3*i+k] = geometry[t].vertices[k][1] - geometry[t].vertices[k][0];
+            bvh->e2[3*i+k] = geometry[t].vertices[k][2] - geometry[t].vertices[k][0];
+        }
+    }
+    
+    // Sample points: centroids of the upward and downward triangles of the
+    // subdivision, in barycentric coordinates
+    for (int t=0; t<n_surf; t++){
+        double *smp = bvh->samples + 3*(size_t)t*bvh->n_samples;
+        int s = 0;
+        for (int i=0; i<n_sub; i++){
+            for (int j=0; j<n_sub-i; j++){
+                for (int up=0; up<2; up++){
+                    if ((up == 1) && (i+j > n_sub-2))
+                        continue;
+                    double b1 = (i + ((up == 0) ? 1/3.0 : 2/3.0))/n_sub;
+                    double b2 = (j + ((up == 0) ? 1/3.0 : 2/3.0))/n_sub;
+                    for (int k=0; k<3; k++)
+                        smp[3*s+k] = geometry[t].vertices[k][0] + b1*(geometry[t].vertices[k][1] - geometry[t].vertices[k][0]) + b2*(geometry[t].vertices[k][2] - geometry[t].vertices[k][0]);
+                    s++;
+                }
+            }
+        }
+    }
+    
+    free(centroid);
+}
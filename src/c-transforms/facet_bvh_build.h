@@ -0,0 +1,45 @@
+//
+//  facet_bvh_build.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_bvh_build.c
+//%
+//% DESCRIPTION:          This function builds the bounding-volume hierarchy
+//%                       of the surface geometry model used for
+//%                       self-shadowing. Nodes are split in two halves along
+//%                       the longest extent of the triangle centroids, down
+//%                       to FACET_BVH_LEAF triangles. Each surface is
+//%                       sampled at the centroids of the n_sub x n_sub
+//%                       triangles of its regular subdivision
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_surf: number of surfaces in geometry model
+//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       int n_sub: sample points per surface edge
+//%                       int n_cache: visibility cache cells per cube face
+//%                         edge, 0 to cast the rays at every call
+//%
+//% OUTPUT:               struct facet_bvh *bvh: bounding-volume hierarchy
+//%
+//% COUPLING:             - surface.h
+//%                       - facet_bvh.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_bvh_build_h
+#define facet_bvh_build_h
+
+#include <stdio.h>
+#include "surface.h"
+#include "facet_bvh.h"
+
+void facet_bvh_build(int n_surf, struct surface geometry[n_surf], int n_sub, int n_cache, struct facet_bvh *bvh);
+
+#endif /* facet_bvh_build_h */
@@ -0,0 +1,49 @@
+//
+//  facet_table.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_table.h
+//%
+//% DESCRIPTION:          This structure contains the drag coefficients
+//%                       (facets_drag.c) and the radiation force and torque
+//%                       (facets_radiation.c) of the surface geometry model
+//%                       tabulated against the flux direction in body frame,
+//%                       on the nodes of a cube map: each face of the cube
+//%                       [-1,1]^3 is divided in n x n cells and a direction
+//%                       is interpolated bilinearly on the face it points to
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int facet_table.n: cells per face edge, 0 if the
+//%                         table is not used
+//%                       double *facet_table.values: values at the nodes,
+//%                         [6][n+1][n+1][FACET_TABLE_N_VALUES] with faces
+//%                         +x, -x, +y, -y, +z, -z:
+//%                         - [0]-[25]: drag coefficients
+//%                         - [26]-[28]: radiation force, optical properties
+//%                         - [29]-[31]: radiation torque, optical properties
+//%                         - [32]-[34]: radiation force, infrared properties
+//%                         - [35]-[37]: radiation torque, infrared properties
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_table_h
+#define facet_table_h
+
+#include "facets.h"
+
+#define FACET_TABLE_N_VALUES (FACETS_DRAG_N + FACETS_RADIATION_N)
+
+struct facet_table
+{
+    int n;
+    double *values;
+};
+
+#endif /* facet_table_h */
@@ -0,0 +1,80 @@
+//
+//  facet_table_build.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_table_build.c
+//%
+//% DESCRIPTION:          This function tabulates the drag coefficients and
+//%                       the radiation force and torque of the surface
+//%                       geometry model at the nodes of a cube map of flux
+//%                       directions (see facet_table.h)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       int n: cells per cube face edge, 0 to not use the
+//%                         table
+//%
+//% OUTPUT:               struct facet_table *ft: facet response table
+//%
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_drag.c
+//%                       - facets_radiation.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facet_table_build.h"
+#include "linalg.h"
+#include <stdlib.h>
+#include "facets.h"
+#include "facet_table.h"
+#include "facets_drag.h"
+#include "facets_radiation.h"
+
+void facet_table_build(struct facets *fa, int n, struct facet_table *ft){
+    
+    ft->n = n;
+    ft->values = NULL;
+    if (n == 0)
+        return;
+    
+    ft->values = malloc((size_t)6*(n+1)*(n+1)*FACET_TABLE_N_VALUES*sizeof(double));
+    if (ft->values == NULL){
+        fprintf(stderr, "Error in 'facet_table_build.c': Could not allocate facet response table\n");
+        exit(-1);
+    }
+    
+    for (int face=0; face<6; face++){
+        
+        // Axis and sign of the face, the two other axes follow cyclically
+        int a = face/2;
+        double s = (face%2 == 0) ? 1 : -1;
+        
+        for (int i=0; i<=n; i++){
+            for (int j=0; j<=n; j++){
+                
+                // Unit flux direction of the node
+                double d[3];
+                d[a] = s;
+                d[(a+1)%3] = -1 + 2.0*i/n;
+                d[(a+2)%3] = -1 + 2.0*j/n;
+                double norm_d = vec3_norm(d);
+                for (int k=0; k<3; k++)
+                    d[k] = d[k]/norm_d;
+                
+                double *val = ft->values + ((size_t)(face*(n+1) + i)*(n+1) + j)*FACET_TABLE_N_VALUES;
+                double *rad = val + FACETS_DRAG_N;
+                facets_drag(fa, d, val);
+                facets_radiation(fa, d, rad, rad+3, rad+6, rad+9);
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+//
+//  facet_table_build.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_table_build.c
+//%
+//% DESCRIPTION:          This function tabulates the drag coefficients and
+//%                       the radiation force and torque of the surface
+//%                       geometry model at the nodes of a cube map of flux
+//%                       directions (see facet_table.h)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       int n: cells per cube face edge, 0 to not use the
+//%                         table
+//%
+//% OUTPUT:               struct facet_table *ft: facet response table
+//%
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_drag.c
+//%                       - facets_radiation.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_table_build_h
+#define facet_table_build_h
+
+#include <stdio.h>
+#include "facets.h"
+#include "facet_table.h"
+
+void facet_table_build(struct facets *fa, int n, struct facet_table *ft);
+
+#endif /* facet_table_build_h */
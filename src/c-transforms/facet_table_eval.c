@@ -0,0 +1,73 @@
+//
+//  facet_table_eval.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_table_eval.c
+//%
+//% DESCRIPTION:          This function interpolates bilinearly a range of
+//%                       values of the facet response table for a flux
+//%                       direction, on the cube face the direction points to.
+//%                       The cost does not depend on the number of surfaces
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct facet_table *ft: facet response table
+//%                       double d[3]: flux direction in body frame (not
+//%                         necessarily unit)
+//%                       int first: index of the first value (see
+//%                         facet_table.h)
+//%                       int count: number of values
+//%
+//% OUTPUT:               double val[count]: interpolated values
+//%
+//% COUPLING:             - facet_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facet_table_eval.h"
+#include <math.h>
+#include "facet_table.h"
+
+void facet_table_eval(const struct facet_table *ft, double d[3], int first, int count, double val[count]){
+    
+    int n = ft->n;
+    
+    // Face of the cube the direction points to
+    int a = 0;
+    if (fabs(d[1]) > fabs(d[a]))
+        a = 1;
+    if (fabs(d[2]) > fabs(d[a]))
+        a = 2;
+    int face = 2*a + ((d[a] < 0) ? 1 : 0);
+    
+    // Cell and position in the cell on that face
+    double x = (d[(a+1)%3]/fabs(d[a]) + 1)*n/2.0;
+    double y = (d[(a+2)%3]/fabs(d[a]) + 1)*n/2.0;
+    int i = (int) x;
+    int j = (int) y;
+    if (i > n-1)
+        i = n-1;
+    if (i < 0)
+        i = 0;
+    if (j > n-1)
+        j = n-1;
+    if (j < 0)
+        j = 0;
+    double fx = x - i;
+    double fy = y - j;
+    
+    // Bilinear interpolation between the four nodes of the cell
+    const double *p00 = ft->values + ((size_t)(face*(n+1) + i)*(n+1) + j)*FACET_TABLE_N_VALUES + first;
+    const double *p01 = p00 + FACET_TABLE_N_VALUES;
+    const double *p10 = p00 + (size_t)(n+1)*FACET_TABLE_N_VALUES;
+    const double *p11 = p10 + FACET_TABLE_N_VALUES;
+    double w00 = (1-fx)*(1-fy), w01 = (1-fx)*fy, w10 = fx*(1-fy), w11 = fx*fy;
+    for (int k=0; k<count; k++)
+        val[k] = w00*p00[k] + w01*p01[k] + w10*p10[k] + w11*p11[k];
+}
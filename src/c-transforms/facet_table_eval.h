@@ -0,0 +1,41 @@
+//
+//  facet_table_eval.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_table_eval.c
+//%
+//% DESCRIPTION:          This function interpolates bilinearly a range of
+//%                       values of the facet response table for a flux
+//%                       direction, on the cube face the direction points to.
+//%                       The cost does not depend on the number of surfaces
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct facet_table *ft: facet response table
+//%                       double d[3]: flux direction in body frame (not
+//%                         necessarily unit)
+//%                       int first: index of the first value (see
+//%                         facet_table.h)
+//%                       int count: number of values
+//%
+//% OUTPUT:               double val[count]: interpolated values
+//%
+//% COUPLING:             - facet_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_table_eval_h
+#define facet_table_eval_h
+
+#include <stdio.h>
+#include "facet_table.h"
+
+void facet_table_eval(const struct facet_table *ft, double d[3], int first, int count, double val[count]);
+
+#endif /* facet_table_eval_h */
@@ -0,0 +1,162 @@
+//
+//  facet_visibility.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_visibility.c
+//%
+//% DESCRIPTION:          This function calculates the fraction of each
+//%                       surface that is not shadowed by the rest of the
+//%                       geometry for a flux direction: a ray is cast from
+//%                       each sample point of the surface towards the source
+//%                       and tested against the bounding-volume hierarchy.
+//%                       With the cache, the fractions are computed once for
+//%                       the direction of the center of each cube map cell
+//%                       and reused for all directions in that cell
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facet_bvh *bvh: bounding-volume hierarchy
+//%                       struct facets *fa: surface geometry model, with the
+//%                         cosines of the surfaces for this direction
+//%                       double d[3]: unit flux direction in body frame
+//%
+//% OUTPUT:               struct facets *fa: visible fractions of the
+//%                         surfaces (1 without occlusion)
+//%                       struct facet_bvh *bvh: updated cache
+//%
+//% COUPLING:             - facets.h
+//%                       - facet_bvh.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facet_visibility.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "facets.h"
+#include "facet_bvh.h"
+
+// Any-hit test of the ray o + t*r, t > eps, against all triangles but skip
+static int occluded(const struct facet_bvh *bvh, const double o[3], const double r[3], const double inv_r[3], int skip){
+    
+    int stack[64];
+    int n_stack = 0;
+    stack[n_stack++] = 0;
+    
+    while (n_stack > 0){
+        int node = stack[--n_stack];
+        
+        // Slab test of the node box
+        double tmin = 0, tmax = INFINITY;
+        for (int k=0; k<3; k++){
+            double t1 = (bvh->bmin[3*node+k] - o[k])*inv_r[k];
+            double t2 = (bvh->bmax[3*node+k] - o[k])*inv_r[k];
+            tmin = fmax(tmin, fmin(t1, t2));
+            tmax = fmin(tmax, fmax(t1, t2));
+        }
+        if (tmax < tmin)
+            continue;
+        
+        // Inner node
+        if (bvh->count[node] == 0){
+            stack[n_stack++] = bvh->right[node];
+            stack[n_stack++] = node + 1;
+            continue;
+        }
+        
+        // Triangles of the leaf (Moller-Trumbore)
+        for (int i=bvh->first[node]; i<bvh->first[node]+bvh->count[node]; i++){
+            if (bvh->id[i] == skip)
+                continue;
+            const double *v0 = &bvh->v0[3*i], *e1 = &bvh->e1[3*i], *e2 = &bvh->e2[3*i];
+            double p[3] = {r[1]*e2[2] - r[2]*e2[1], r[2]*e2[0] - r[0]*e2[2], r[0]*e2[1] - r[1]*e2[0]};
+            double det = e1[0]*p[0] + e1[1]*p[1] + e1[2]*p[2];
+            if (det == 0)
+                continue;
+            double inv_det = 1.0/det;
+            double s[3] = {o[0] - v0[0], o[1] - v0[1], o[2] - v0[2]};
+            double u = (s[0]*p[0] + s[1]*p[1] + s[2]*p[2])*inv_det;
+            if ((u < 0) || (u > 1))
+                continue;
+            double q[3] = {s[1]*e1[2] - s[2]*e1[1], s[2]*e1[0] - s[0]*e1[2], s[0]*e1[1] - s[1]*e1[0]};
+            double v = (r[0]*q[0] + r[1]*q[1] + r[2]*q[2])*inv_det;
+            if ((v < 0) || (u + v > 1))
+                continue;
+            double t = (e2[0]*q[0] + e2[1]*q[1] + e2[2]*q[2])*inv_det;
+            if (t > bvh->eps)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+// Visible fractions of the surfaces for which mask is not 0, shadow rays cast
+// as one batch in the direction opposite to the flux
+static void cast_rays(struct facet_bvh *bvh, const double d[3], const double *mask, double *vis){
+    
+    double r[3] = {-d[0], -d[1], -d[2]};
+    double inv_r[3] = {1.0/r[0], 1.0/r[1], 1.0/r[2]};
+    
+    for (int i=0; i<bvh->n_surf; i++){
+        vis[i] = 1;
+        if ((mask != NULL) && !(mask[i] > 0))
+            continue;
+        int n_lit = 0;
+        const double *smp = bvh->samples + 3*(size_t)i*bvh->n_samples;
+        for (int s=0; s<bvh->n_samples; s++){
+            if (!occluded(bvh, &smp[3*s], r, inv_r, i))
+                n_lit++;
+        }
+        bvh->n_rays = bvh->n_rays + bvh->n_samples;
+        vis[i] = (double) n_lit/bvh->n_samples;
+    }
+}
+
+void facet_visibility(struct facet_bvh *bvh, struct facets *fa, double d[3]){
+    
+    bvh->n_calls++;
+    int n = bvh->n_cache;
+    
+    // Without cache, surfaces in view only
+    if (n == 0){
+        cast_rays(bvh, d, fa->cos, fa->vis);
+        return;
+    }
+    
+    // Cell of the cube map the direction points to (see facet_table_eval.c)
+    int a = 0;
+    if (fabs(d[1]) > fabs(d[a]))
+        a = 1;
+    if (fabs(d[2]) > fabs(d[a]))
+        a = 2;
+    int face = 2*a + ((d[a] < 0) ? 1 : 0);
+    int i = (int) ((d[(a+1)%3]/fabs(d[a]) + 1)*n/2.0);
+    int j = (int) ((d[(a+2)%3]/fabs(d[a]) + 1)*n/2.0);
+    i = (i > n-1) ? n-1 : ((i < 0) ? 0 : i);
+    j = (j > n-1) ? n-1 : ((j < 0) ? 0 : j);
+    int cell = (face*n + i)*n + j;
+    
+    // Fill the cell with all surfaces on first request
+    if (bvh->cache[cell] == NULL){
+        bvh->cache[cell] = malloc(bvh->n_surf*sizeof(double));
+        if (bvh->cache[cell] == NULL){
+            fprintf(stderr, "Error in 'facet_visibility.c': Could not allocate visibility cache\n");
+            exit(-1);
+        }
+        double dc[3];
+        dc[a] = (face%2 == 0) ? 1 : -1;
+        dc[(a+1)%3] = -1 + (2*i+1.0)/n;
+        dc[(a+2)%3] = -1 + (2*j+1.0)/n;
+        double norm_dc = sqrt(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        for (int k=0; k<3; k++)
+            dc[k] = dc[k]/norm_dc;
+        cast_rays(bvh, dc, NULL, bvh->cache[cell]);
+    }
+    memcpy(fa->vis, bvh->cache[cell], bvh->n_surf*sizeof(double));
+}
@@ -0,0 +1,47 @@
+//
+//  facet_visibility.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facet_visibility.c
+//%
+//% DESCRIPTION:          This function calculates the fraction of each
+//%                       surface that is not shadowed by the rest of the
+//%                       geometry for a flux direction: a ray is cast from
+//%                       each sample point of the surface towards the source
+//%                       and tested against the bounding-volume hierarchy.
+//%                       With the cache, the fractions are computed once for
+//%                       the direction of the center of each cube map cell
+//%                       and reused for all directions in that cell
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facet_bvh *bvh: bounding-volume hierarchy
+//%                       struct facets *fa: surface geometry model, with the
+//%                         cosines of the surfaces for this direction
+//%                       double d[3]: unit flux direction in body frame
+//%
+//% OUTPUT:               struct facets *fa: visible fractions of the
+//%                         surfaces (1 without occlusion)
+//%                       struct facet_bvh *bvh: updated cache
+//%
+//% COUPLING:             - facets.h
+//%                       - facet_bvh.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facet_visibility_h
+#define facet_visibility_h
+
+#include <stdio.h>
+#include "facets.h"
+#include "facet_bvh.h"
+
+void facet_visibility(struct facet_bvh *bvh, struct facets *fa, double d[3]);
+
+#endif /* facet_visibility_h */
@@ -0,0 +1,89 @@
+//
+//  facets.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets.h
+//%
+//% DESCRIPTION:          This structure contains the spacecraft geometry as
+//%                       one array per property (structure of arrays) with
+//%                       the per-surface quantities needed by the drag and
+//%                       radiation pressure models precomputed by
+//%                       load_facets.c, so that their loops over surfaces
+//%                       are plain weighted sums
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int facets.n: number of surfaces
+//%                       double *facets.area: area (m2)
+//%                       double *facets.nx, *ny, *nz: inward normal
+//%                       double *facets.inv_n: inverse of the norm of the
+//%                         normal (1 within the tolerance of sc_geometry.c)
+//%                       double *facets.cx, *cy, *cz: centroid in body
+//%                         frame (m)
+//%                       double *facets.cnx, *cny, *cnz: centroid cross
+//%                         normal (m)
+//%                       double *facets.qxx, *qxy, *qxz, *qyy, *qyz, *qzz:
+//%                         second moment of area of the surface about the
+//%                         center of mass (integral of r r^T, m4)
+//%                       double *facets.crs, *crd, *ca: specular, diffuse
+//%                         and absorption coefficients in optical range
+//%                       double *facets.crs_ir, *crd_ir, *ca_ir: same in
+//%                         infrared range
+//%                       double *facets.cos, *proj: cosine of the angle
+//%                         between the flux and the normal and projected
+//%                         area (m2, 0 if not in view) of the last call
+//%                       double *facets.vis: visible fraction of the
+//%                         surfaces (1 without self-shadowing) of the last
+//%                         call
+//%                       struct facet_bvh *facets.bvh: hierarchy used for
+//%                         self-shadowing, NULL if disabled
+//%                       double *facets.data: storage of all arrays
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facets_h
+#define facets_h
+
+#define FACETS_N_ARRAYS 26
+
+// Number of drag coefficients (facets_drag.c) and of radiation force and
+// torque components (facets_radiation.c) for one flux direction
+#define FACETS_DRAG_N 26
+#define FACETS_RADIATION_N 12
+
+struct facet_bvh;
+
+struct facets
+{
+    int n;
+    
+    // Geometry
+    double *area;
+    double *nx, *ny, *nz;
+    double *inv_n;
+    double *cx, *cy, *cz;
+    double *cnx, *cny, *cnz;
+    double *qxx, *qxy, *qxz, *qyy, *qyz, *qzz;
+    
+    // Optical properties
+    double *crs, *crd, *ca;
+    double *crs_ir, *crd_ir, *ca_ir;
+    
+    // Scratch of the last call
+    double *cos;
+    double *proj;
+    double *vis;
+    
+    // Self-shadowing
+    struct facet_bvh *bvh;
+    
+    double *data;
+};
+
+#endif /* facets_h */
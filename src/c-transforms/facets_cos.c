@@ -0,0 +1,61 @@
+//
+//  facets_cos.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_cos.c
+//%
+//% DESCRIPTION:          This function calculates the cosine of the angle
+//%                       between a flux direction and the normal of each
+//%                       surface, and the projected area of the surfaces in
+//%                       view of the flux (0 for the others). With
+//%                       self-shadowing, only the visible fraction of each
+//%                       surface is projected
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: flux direction in body frame (not
+//%                         necessarily unit)
+//%
+//% OUTPUT:               struct facets *fa: cosines, projected areas and
+//%                         visible fractions of the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - linalg.h
+//%                       - facet_visibility.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facets_cos.h"
+#include "linalg.h"
+#include "facets.h"
+#include "facet_visibility.h"
+
+// Distinct arrays, so that the loop can be vectorized without alias checks
+static void cos_kernel(int n, const double *restrict nx, const double *restrict ny, const double *restrict nz, const double *restrict inv_n, const double *restrict area, double dx, double dy, double dz, double *restrict cos_alpha, double *restrict proj){
+    
+    for (int i=0; i<n; i++){
+        cos_alpha[i] = (nx[i]*dx + ny[i]*dy + nz[i]*dz)*inv_n[i];
+        proj[i] = (cos_alpha[i]>0 ? cos_alpha[i] : 0)*area[i];
+    }
+}
+
+void facets_cos(struct facets *fa, double d[3]){
+    
+    double inv_d = 1.0/vec3_norm(d);
+    double d_unit[3] = {d[0]*inv_d, d[1]*inv_d, d[2]*inv_d};
+    cos_kernel(fa->n, fa->nx, fa->ny, fa->nz, fa->inv_n, fa->area, d_unit[0], d_unit[1], d_unit[2], fa->cos, fa->proj);
+    
+    // Self-shadowing
+    if (fa->bvh != NULL){
+        facet_visibility(fa->bvh, fa, d_unit);
+        for (int i=0; i<fa->n; i++)
+            fa->proj[i] = fa->proj[i]*fa->vis[i];
+    }
+}
@@ -0,0 +1,43 @@
+//
+//  facets_cos.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_cos.c
+//%
+//% DESCRIPTION:          This function calculates the cosine of the angle
+//%                       between a flux direction and the normal of each
+//%                       surface, and the projected area of the surfaces in
+//%                       view of the flux (0 for the others). With
+//%                       self-shadowing, only the visible fraction of each
+//%                       surface is projected
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: flux direction in body frame (not
+//%                         necessarily unit)
+//%
+//% OUTPUT:               struct facets *fa: cosines, projected areas and
+//%                         visible fractions of the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - linalg.h
+//%                       - facet_visibility.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facets_cos_h
+#define facets_cos_h
+
+#include <stdio.h>
+#include "facets.h"
+
+void facets_cos(struct facets *fa, double d[3]);
+
+#endif /* facets_cos_h */
@@ -0,0 +1,107 @@
+//
+//  facets_drag.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_drag.c
+//%
+//% DESCRIPTION:          This function calculates, in a single pass over the
+//%                       surfaces in view of the wind, the sums over the
+//%                       surfaces that the drag force and torque of
+//%                       aero_drag.c depend on. They only depend on the wind
+//%                       direction in body frame: the wind speed and the
+//%                       angular velocity enter linearly. With v the wind
+//%                       velocity, w the angular velocity, u = n x w and Q
+//%                       the second moment of area of a surface, the force
+//%                       is K*sum[(Ap*|v| + A*n.(c x w))*v + Ap*|v|*(c x w)]
+//%                       and the torque is
+//%                       K*sum[(A*(n.v)*c - Q*u) x v - (n.v)*(tr(Q)*w - Q*w)]
+//%                       With self-shadowing, A and Q of each surface are
+//%                       scaled by its visible fraction
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: unit wind direction in body frame
+//%
+//% OUTPUT:               double coef[FACETS_DRAG_N]: sums over the surfaces
+//%                         in view of the wind (Ap: projected area, A: area,
+//%                         c: centroid, n: normal)
+//%                         - coef[0]: sum of Ap
+//%                         - coef[1]-[3]: sum of Ap*c
+//%                         - coef[4]-[6]: sum of A*(c x n)
+//%                         - coef[7]-[9]: sum of A*(n.d)*c
+//%                         - coef[10]-[18]: sum of Q*[n]x (row by row),
+//%                           with [n]x*w = n x w
+//%                         - coef[19]: sum of (n.d)*tr(Q)
+//%                         - coef[20]-[25]: sum of (n.d)*Q (xx, xy, xz, yy,
+//%                           yz, zz)
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - facets_cos.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facets_drag.h"
+#include "facets.h"
+#include "facets_cos.h"
+
+void facets_drag(struct facets *fa, double d[3], double coef[FACETS_DRAG_N]){
+    
+    // Cosines and projected areas of surfaces in view of the wind
+    facets_cos(fa, d);
+    
+    for (int k=0; k<FACETS_DRAG_N; k++)
+        coef[k] = 0;
+    
+    double dx = d[0], dy = d[1], dz = d[2];
+    for (int i=0; i<fa->n; i++){
+        if (fa->cos[i]>0){
+            double vis = fa->vis[i];
+            double a = fa->area[i]*vis, ap = fa->proj[i];
+            double cx = fa->cx[i], cy = fa->cy[i], cz = fa->cz[i];
+            double nx = fa->nx[i], ny = fa->ny[i], nz = fa->nz[i];
+            double qxx = fa->qxx[i]*vis, qxy = fa->qxy[i]*vis, qxz = fa->qxz[i]*vis;
+            double qyy = fa->qyy[i]*vis, qyz = fa->qyz[i]*vis, qzz = fa->qzz[i]*vis;
+            double nd = nx*dx + ny*dy + nz*dz;
+            double a_nd = a*nd;
+            
+            // Force
+            coef[0] = coef[0] + ap;
+            coef[1] = coef[1] + ap*cx;
+            coef[2] = coef[2] + ap*cy;
+            coef[3] = coef[3] + ap*cz;
+            coef[4] = coef[4] + a*fa->cnx[i];
+            coef[5] = coef[5] + a*fa->cny[i];
+            coef[6] = coef[6] + a*fa->cnz[i];
+            
+            // Torque
+            coef[7] = coef[7] + a_nd*cx;
+            coef[8] = coef[8] + a_nd*cy;
+            coef[9] = coef[9] + a_nd*cz;
+            coef[10] = coef[10] + qxy*nz - qxz*ny;
+            coef[11] = coef[11] + qxz*nx - qxx*nz;
+            coef[12] = coef[12] + qxx*ny - qxy*nx;
+            coef[13] = coef[13] + qyy*nz - qyz*ny;
+            coef[14] = coef[14] + qyz*nx - qxy*nz;
+            coef[15] = coef[15] + qxy*ny - qyy*nx;
+            coef[16] = coef[16] + qyz*nz - qzz*ny;
+            coef[17] = coef[17] + qzz*nx - qxz*nz;
+            coef[18] = coef[18] + qxz*ny - qyz*nx;
+            coef[19] = coef[19] + nd*(qxx + qyy + qzz);
+            coef[20] = coef[20] + nd*qxx;
+            coef[21] = coef[21] + nd*qxy;
+            coef[22] = coef[22] + nd*qxz;
+            coef[23] = coef[23] + nd*qyy;
+            coef[24] = coef[24] + nd*qyz;
+            coef[25] = coef[25] + nd*qzz;
+        }
+    }
+}
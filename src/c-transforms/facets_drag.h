@@ -0,0 +1,60 @@
+//
+//  facets_drag.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_drag.c
+//%
+//% DESCRIPTION:          This function calculates, in a single pass over the
+//%                       surfaces in view of the wind, the sums over the
+//%                       surfaces that the drag force and torque of
+//%                       aero_drag.c depend on. They only depend on the wind
+//%                       direction in body frame: the wind speed and the
+//%                       angular velocity enter linearly. With v the wind
+//%                       velocity, w the angular velocity, u = n x w and Q
+//%                       the second moment of area of a surface, the force
+//%                       is K*sum[(Ap*|v| + A*n.(c x w))*v + Ap*|v|*(c x w)]
+//%                       and the torque is
+//%                       K*sum[(A*(n.v)*c - Q*u) x v - (n.v)*(tr(Q)*w - Q*w)]
+//%                       With self-shadowing, A and Q of each surface are
+//%                       scaled by its visible fraction
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: unit wind direction in body frame
+//%
+//% OUTPUT:               double coef[FACETS_DRAG_N]: sums over the surfaces
+//%                         in view of the wind (Ap: projected area, A: area,
+//%                         c: centroid, n: normal)
+//%                         - coef[0]: sum of Ap
+//%                         - coef[1]-[3]: sum of Ap*c
+//%                         - coef[4]-[6]: sum of A*(c x n)
+//%                         - coef[7]-[9]: sum of A*(n.d)*c
+//%                         - coef[10]-[18]: sum of Q*[n]x (row by row),
+//%                           with [n]x*w = n x w
+//%                         - coef[19]: sum of (n.d)*tr(Q)
+//%                         - coef[20]-[25]: sum of (n.d)*Q (xx, xy, xz, yy,
+//%                           yz, zz)
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - facets_cos.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facets_drag_h
+#define facets_drag_h
+
+#include <stdio.h>
+#include "facets.h"
+
+void facets_drag(struct facets *fa, double d[3], double coef[FACETS_DRAG_N]);
+
+#endif /* facets_drag_h */
@@ -0,0 +1,88 @@
+//
+//  facets_radiation.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_radiation.c
+//%
+//% DESCRIPTION:          This function calculates, in a single pass over the
+//%                       surfaces in view of a radiation flux, the force and
+//%                       torque in body frame per unit radiation pressure.
+//%                       The force on a surface is
+//%                       (ca+crd)*Ap*d + (2*crd/3 + 2*crs*cos)*Ap*normal,
+//%                       so both resultants only need four sums over the
+//%                       surfaces
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: unit flux direction in body frame
+//%
+//% OUTPUT:               double f[3]: force with optical properties in body
+//%                         frame (m2), only computed if not NULL
+//%                       double g[3]: torque with optical properties in body
+//%                         frame (m3), only computed if f is not NULL
+//%                       double f_ir[3]: force with infrared properties in
+//%                         body frame (m2), only computed if not NULL
+//%                       double g_ir[3]: torque with infrared properties in
+//%                         body frame (m3), only computed if f_ir is not NULL
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - linalg.h
+//%                       - facets_cos.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "facets_radiation.h"
+#include "linalg.h"
+#include "facets.h"
+#include "facets_cos.h"
+
+// Force and torque of one set of optical properties from the sums over the
+// surfaces in view of the absorbed and diffuse part along the flux and of the
+// normal part
+static void radiation_sums(const struct facets *fa, const double *crs, const double *crd, const double *ca, double d[3], double f[3], double g[3]){
+    
+    double Al = 0, Alc[3] = {0,0,0}, An[3] = {0,0,0}, Acn[3] = {0,0,0};
+    for (int i=0; i<fa->n; i++){
+        double ap = fa->proj[i];
+        double kl = (ca[i] + crd[i])*ap;
+        double kn = (2*crd[i]/3.0 + 2*crs[i]*fa->cos[i])*ap;
+        Al = Al + kl;
+        Alc[0] = Alc[0] + kl*fa->cx[i];
+        Alc[1] = Alc[1] + kl*fa->cy[i];
+        Alc[2] = Alc[2] + kl*fa->cz[i];
+        An[0] = An[0] + kn*fa->nx[i];
+        An[1] = An[1] + kn*fa->ny[i];
+        An[2] = An[2] + kn*fa->nz[i];
+        Acn[0] = Acn[0] + kn*fa->cnx[i];
+        Acn[1] = Acn[1] + kn*fa->cny[i];
+        Acn[2] = Acn[2] + kn*fa->cnz[i];
+    }
+    
+    // Sum of forces and sum of centroid cross forces
+    double Alcxd[3];
+    vec3_cross(Alc, d, Alcxd);
+    for (int i=0; i<3; i++){
+        f[i] = Al*d[i] + An[i];
+        g[i] = Alcxd[i] + Acn[i];
+    }
+}
+
+void facets_radiation(struct facets *fa, double d[3], double f[3], double g[3], double f_ir[3], double g_ir[3]){
+    
+    // Cosines and projected areas of surfaces in view of the flux
+    facets_cos(fa, d);
+    
+    if (f != NULL)
+        radiation_sums(fa, fa->crs, fa->crd, fa->ca, d, f, g);
+    if (f_ir != NULL)
+        radiation_sums(fa, fa->crs_ir, fa->crd_ir, fa->ca_ir, d, f_ir, g_ir);
+}
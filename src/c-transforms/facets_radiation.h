@@ -0,0 +1,51 @@
+//
+//  facets_radiation.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        facets_radiation.c
+//%
+//% DESCRIPTION:          This function calculates, in a single pass over the
+//%                       surfaces in view of a radiation flux, the force and
+//%                       torque in body frame per unit radiation pressure.
+//%                       The force on a surface is
+//%                       (ca+crd)*Ap*d + (2*crd/3 + 2*crs*cos)*Ap*normal,
+//%                       so both resultants only need four sums over the
+//%                       surfaces
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct facets *fa: surface geometry model
+//%                       double d[3]: unit flux direction in body frame
+//%
+//% OUTPUT:               double f[3]: force with optical properties in body
+//%                         frame (m2), only computed if not NULL
+//%                       double g[3]: torque with optical properties in body
+//%                         frame (m3), only computed if f is not NULL
+//%                       double f_ir[3]: force with infrared properties in
+//%                         body frame (m2), only computed if not NULL
+//%                       double g_ir[3]: torque with infrared properties in
+//%                         body frame (m3), only computed if f_ir is not NULL
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces
+//%
+//% COUPLING:             - facets.h
+//%                       - linalg.h
+//%                       - facets_cos.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef facets_radiation_h
+#define facets_radiation_h
+
+#include <stdio.h>
+#include "facets.h"
+
+void facets_radiation(struct facets *fa, double d[3], double f[3], double g[3], double f_ir[3], double g_ir[3]);
+
+#endif /* facets_radiation_h */
@@ -0,0 +1,65 @@
+//
+//  frame_cache.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        frame_cache.h
+//%
+//% DESCRIPTION:          This structure contains the TEME/ECEF rotation of
+//%                       the last epoch requested from teme2ecef_cached.c
+//%                       (sidereal time and polar motion), shared by all
+//%                       integrator stages of a step
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int frame_cache.valid: 1 if the rotation is set
+//%                       double frame_cache.t2000ut1: epoch (s since
+//%                         January 1, 2000, 00:00:00 UT1)
+//%                       double frame_cache.ttt: julian centuries of TT
+//%                       double frame_cache.xp, yp: polar motion
+//%                         parameters from EOP
+//%                       double frame_cache.lod: length of day from EOP
+//%                       double frame_cache.st_t[3][3]: rotation matrix
+//%                         from TEME to PEF (sidereal time)
+//%                       double frame_cache.pm_t[3][3]: rotation matrix
+//%                         from PEF to ECEF (polar motion)
+//%                       double frame_cache.C_ecef2teme[3][3]: rotation
+//%                         matrix from ECEF to TEME
+//%                       double frame_cache.omegaearth[3]: Earth angular
+//%                         velocity in PEF (rad s-1)
+//%                       long frame_cache.n_calls: number of requests
+//%                       long frame_cache.n_updates: number of rotations
+//%                         computed
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef frame_cache_h
+#define frame_cache_h
+
+struct frame_cache
+{
+    // Epoch and Earth orientation parameters of the rotation
+    int valid;
+    double t2000ut1;
+    double ttt;
+    double xp;
+    double yp;
+    double lod;
+    
+    // Rotation matrices and Earth angular velocity
+    double st_t[3][3];
+    double pm_t[3][3];
+    double C_ecef2teme[3][3];
+    double omegaearth[3];
+    
+    // Statistics
+    long n_calls;
+    long n_updates;
+};
+
+#endif /* frame_cache_h */
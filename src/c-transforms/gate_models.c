@@ -0,0 +1,176 @@
+//
+//  gate_models.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        gate_models.c
+//%
+//% DESCRIPTION:          This function will decide, after each step, which
+//%                       models propagation.c evaluates during the next one.
+//%                       Aerodynamics are skipped above the maximum altitude,
+//%                       and aerodynamics, HWM14 winds, albedo and IR are
+//%                       skipped when the running estimate of their
+//%                       acceleration and torque relative to the total
+//%                       acceleration (two-body term included) and torque
+//%                       is below the tolerance. Skipped models are
+//%                       evaluated again every 'recheck' steps to refresh
+//%                       their estimate, and aerodynamics for one step when
+//%                       descending below the maximum altitude. The aerodynamic estimate grows with
+//%                       decreasing altitude (50 km scale height), and the
+//%                       HWM14 wind effect is taken as 3% of the
+//%                       aerodynamic one (co-rotating winds are kept). The
+//%                       gravity acceleration degree is limited to the
+//%                       degrees whose Kaula-rule magnitude relative to the
+//%                       two-body term is above the tolerance. Each switch
+//%                       is printed to screen (winds switched off with
+//%                       aerodynamics are not)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct model_gating *mg: model gating state
+//%                       double time_current: time since start (s)
+//%                       double x[13]: state vector at the end of the step
+//%                       double fg_i[42]: forces and torques of the last
+//%                         stage of the step (see propagation.c)
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%
+//% OUTPUT:               None (struct model_gating is updated)
+//%
+//% COUPLING:             - model_gating.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "gate_models.h"
+#include <math.h>
+
+// Largest of the acceleration and torque magnitudes relative to their totals
+static double relative(double fg_i[42], int i_a, int i_g, double a_tot, double g_tot){
+    
+    double a = sqrt(fg_i[i_a]*fg_i[i_a] + fg_i[i_a+1]*fg_i[i_a+1] + fg_i[i_a+2]*fg_i[i_a+2]);
+    double g = sqrt(fg_i[i_g]*fg_i[i_g] + fg_i[i_g+1]*fg_i[i_g+1] + fg_i[i_g+2]*fg_i[i_g+2]);
+    double r = a/a_tot;
+    if ((g_tot > 0) && (g/g_tot > r))
+        r = g/g_tot;
+    return r;
+}
+
+// Print and count a switch
+static void log_switch(struct model_gating *mg, double time_current, double alt, const char *name, int off, double est){
+    
+    if (off == 2)
+        printf("Model gating: %.1f s, altitude %.1f km: %s off (above %.1f km)\n", time_current, alt, name, mg->alt_max);
+    else
+        printf("Model gating: %.1f s, altitude %.1f km: %s %s (relative magnitude %.2e)\n", time_current, alt, name, off ? "off" : "on", est);
+    mg->n_switch++;
+}
+
+void gate_models(struct model_gating *mg, double time_current, double x[13], double fg_i[42], double model_parameters[N_MODEL_PARAMETERS]){
+    
+    double mu = 3986004.418*pow(10,8);
+    double R = 6378136.3;
+    double H_aero = 50;
+    double wind_fraction = 0.03;
+    
+    // User inclusion
+    int in_aero = model_parameters[0] || model_parameters[1];
+    int in_wind = in_aero && (model_parameters[21]>=1);
+    int in_alb = model_parameters[8] || model_parameters[11];
+    int in_ir = model_parameters[9] || model_parameters[12];
+    int in_grav_a = model_parameters[2];
+    int l_max_a = model_parameters[14];
+    
+    // Altitude (spherical Earth) and total acceleration and torque
+    double r = sqrt(x[3]*x[3] + x[4]*x[4] + x[5]*x[5]);
+    double alt = (r - R)/1000.0;
+    double a_sum[3], g_sum[3];
+    for (int i=0; i<3; i++){
+        a_sum[i] = -mu*x[i+3]/(r*r*r);
+        g_sum[i] = 0;
+        for (int k=0; k<42; k+=3){
+            if ((k==3)||(k==9)||(k==12)||(k>=30))
+                g_sum[i] = g_sum[i] + fg_i[k+i];
+            else
+                a_sum[i] = a_sum[i] + fg_i[k+i];
+        }
+    }
+    double a_tot = sqrt(a_sum[0]*a_sum[0] + a_sum[1]*a_sum[1] + a_sum[2]*a_sum[2]);
+    double g_tot = sqrt(g_sum[0]*g_sum[0] + g_sum[1]*g_sum[1] + g_sum[2]*g_sum[2]);
+    
+    // Update running estimates of the models evaluated during the step (the
+    // maximum decays by half over a re-evaluation interval)
+    double decay = pow(0.5, 1.0/mg->recheck);
+    int evaluated[3] = {(mg->off_aero == 0) || ((mg->off_aero == 1) && mg->probe), (mg->off_alb == 0) || mg->probe, (mg->off_ir == 0) || mg->probe};
+    if (mg->n_step == 0){
+        for (int k=0; k<4; k++)
+            mg->est[k] = 0;
+        mg->h_aero = alt;
+    }
+    if (in_aero && evaluated[0]){
+        double est = mg->est[0]*decay*exp((alt - mg->h_aero)/H_aero);
+        mg->est[0] = fmax(relative(fg_i, 0, 3, a_tot, g_tot), est);
+        mg->h_aero = alt;
+    }
+    if (in_alb && evaluated[1])
+        mg->est[2] = fmax(relative(fg_i, 24, 33, a_tot, g_tot), mg->est[2]*decay);
+    if (in_ir && evaluated[2])
+        mg->est[3] = fmax(relative(fg_i, 27, 36, a_tot, g_tot), mg->est[3]*decay);
+    
+    // Aerodynamic estimate at the current altitude (only increased)
+    double est_aero = mg->est[0]*exp(fmax(mg->h_aero - alt, 0)/H_aero);
+    mg->est[1] = wind_fraction*est_aero;
+    
+    // Decisions
+    int off_aero = 0, off_wind = 0, off_alb = 0, off_ir = 0;
+    if (in_aero){
+        if (alt > mg->alt_max)
+            off_aero = 2;
+        else if ((est_aero < mg->tol) && (mg->off_aero != 2))
+            off_aero = 1;
+    }
+    if (in_wind && (off_aero || (mg->est[1] < mg->tol)))
+        off_wind = 1;
+    if (in_alb && (mg->est[2] < mg->tol))
+        off_alb = 1;
+    if (in_ir && (mg->est[3] < mg->tol))
+        off_ir = 1;
+    
+    // Gravity degree: Kaula's rule |C_lm| ~ 1e-5/l^2, acceleration of degree l
+    // ~ (l+1)*sqrt(2l+1)*1e-5/l^2*(R/r)^l relative to the two-body term
+    int l_max = 0;
+    if (in_grav_a && (l_max_a > 2)){
+        l_max = 2;
+        while ((l_max < l_max_a) && ((l_max+2)*sqrt(2*l_max+3)*1e-5/((l_max+1)*(l_max+1))*pow(R/r, l_max+1) >= mg->tol))
+            l_max++;
+        if (l_max == l_max_a)
+            l_max = 0;
+    }
+    
+    // Log switches
+    if (off_aero != mg->off_aero)
+        log_switch(mg, time_current, alt, "aerodynamics", off_aero, est_aero);
+    if ((off_wind != mg->off_wind) && !(off_aero && off_wind))
+        log_switch(mg, time_current, alt, "HWM14 winds", off_wind, mg->est[1]);
+    if (off_alb != mg->off_alb)
+        log_switch(mg, time_current, alt, "albedo", off_alb, mg->est[2]);
+    if (off_ir != mg->off_ir)
+        log_switch(mg, time_current, alt, "IR", off_ir, mg->est[3]);
+    if (l_max != mg->l_max_a){
+        printf("Model gating: %.1f s, altitude %.1f km: gravity acceleration degree %d\n", time_current, alt, (l_max > 0) ? l_max : l_max_a);
+        mg->n_switch++;
+    }
+    mg->off_aero = off_aero;
+    mg->off_wind = off_wind;
+    mg->off_alb = off_alb;
+    mg->off_ir = off_ir;
+    mg->l_max_a = l_max;
+    
+    // Re-evaluate skipped models during the next step
+    mg->n_step++;
+    mg->probe = (mg->n_step % mg->recheck == 0);
+    
+}
@@ -0,0 +1,55 @@
+//
+//  gate_models.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        gate_models.c
+//%
+//% DESCRIPTION:          This function will decide, after each step, which
+//%                       models propagation.c evaluates during the next one.
+//%                       Aerodynamics are skipped above the maximum altitude,
+//%                       and aerodynamics, HWM14 winds, albedo and IR are
+//%                       skipped when the running estimate of their
+//%                       acceleration and torque relative to the total
+//%                       acceleration (two-body term included) and torque
+//%                       is below the tolerance. Skipped models are
+//%                       evaluated again every 'recheck' steps to refresh
+//%                       their estimate. The aerodynamic estimate grows with
+//%                       decreasing altitude (50 km scale height), and the
+//%                       HWM14 wind effect is taken as 3% of the
+//%                       aerodynamic one (co-rotating winds are kept). The
+//%                       gravity acceleration degree is limited to the
+//%                       degrees whose Kaula-rule magnitude relative to the
+//%                       two-body term is above the tolerance. Each switch
+//%                       is printed to screen
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct model_gating *mg: model gating state
+//%                       double time_current: time since start (s)
+//%                       double x[13]: state vector at the end of the step
+//%                       double fg_i[42]: forces and torques of the last
+//%                         stage of the step (see propagation.c)
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%
+//% OUTPUT:               None (struct model_gating is updated)
+//%
+//% COUPLING:             - model_gating.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef gate_models_h
+#define gate_models_h
+
+#include <stdio.h>
+#include "load_model_parameters.h"
+#include "model_gating.h"
+
+void gate_models(struct model_gating *mg, double time_current, double x[13], double fg_i[42], double model_parameters[N_MODEL_PARAMETERS]);
+
+#endif /* gate_models_h */
@@ -16,15 +16,17 @@
 //% VERSION:              1
 //%
 //% INPUT:                double int atmos_model: which atmospheric model?
+//%                         (1: NRLMSISE-00, 2: JB2008, 3: exponential,
+//%                         4: Harris-Priester)
 //%                       double LLA[4]:
 //%                         - LLA[0]: geocentric latitude (rad)
 //%                         - LLA[1]: geodetic latitude (rad)
 //%                         - LLA[2]: longitude (rad)
 //%                         - LLA[3]: altitude (km)
 //%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
-//%                       int length_of_file[5]: array containing length of file values
-//%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
-//%                       double solar_input[length_of_file[1]][3]: F10.7 array for NRLMSISE-00
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct jb2008_cache *jc: JB2008 inputs of the last
+//%                         epoch
 //%                       double Apc: user-inputted Ap value
 //%                       double F107c: user-inputted F10.7 value
 //%
@@ -34,6 +36,10 @@
 //% COUPLING:             - t2doy.c
 //%                       - crossprod.c
 //%                       - nrlmsise-00.c
+//%                       - space_weather_msis.c
+//%                       - jb2008_epoch.c
+//%                       - density_exponential.c
+//%                       - density_harris_priester.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -41,7 +47,9 @@
 #define get_density_h
 
 #include <stdio.h>
+#include "space_weather.h"
+#include "jb2008_cache.h"
 
-double get_density(int atmos_model, double LLA[4], double t2000utc, int length_of_file[5], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], double Apc, double F107c);
+double get_density(int atmos_model, double LLA[4], double t2000utc, const struct space_weather *sw, struct jb2008_cache *jc, double Apc, double F107c);
 
 #endif /* get_density_h */
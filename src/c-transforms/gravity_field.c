@@ -40,18 +40,26 @@
 //%                         non-spherical Earth in inertial frame
 //%                       double g_gravity_body[3]: gravity-gradient torque
 //%                         in body-fixed frame
+//%                       double *U_gravity: gravitational potential per unit
+//%                         mass up to l_max_a, including the spherical term
+//%                         (J kg-1), only computed with the acceleration and
+//%                         if not NULL
 //%
-//% COUPLING:             - matrixmult.c
+//% COUPLING:             - linalg.h
 //%                       - matxvec.c
+//%                       - sph_legendre.c
+//%                       - sph_synthesis.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "gravity_field.h"
+#include "linalg.h"
 #include <math.h>
-#include "matrixmult.h"
 #include "matxvec.h"
+#include "sph_legendre.h"
+#include "sph_synthesis.h"
 
-void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3][3], double Inertia[3][3], double C[101][101], double S[101][101], int l_max_a, int l_max_g, int in_grav_a, int in_grav_g, double a_gravity_inertial[3], double g_gravity_body[3]){
+void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3][3], double Inertia[3][3], double C[101][101], double S[101][101], int l_max_a, int l_max_g, int in_grav_a, int in_grav_g, double a_gravity_inertial[3], double g_gravity_body[3], double *U_gravity){
     
     // Use highest maximum degree and order considered for acceleration anf torque
     int l_max = l_max_a;
@@ -75,40 +83,27 @@ void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3]
     double lon = LLA[2];
     double lat = asin(p_ecef[2]/sqrt(p_ecef[0]*p_ecef[0]+p_ecef[1]*p_ecef[1]+p_ecef[2]*p_ecef[2]));
     
-    // Legendre Polynomials
-    double P[103][103];
-    P[0][0] = 1;
-    P[1][0] = sin(lat);
-    P[1][1] = cos(lat);
-    for (int l = 0; l <=l_max; l++){
-        P[l][l+1] = 0;
-        P[l][l+2] = 0;
-    }
-    for (int l = 2; l <= l_max+2 ; ++l ){
-        P[l][0] = ((2*l-1)*sin(lat)*P[l-1][0]-(l-1)*P[l-2][0])/((double)l);
-        for (int m = 1; m<l ; ++m )
-            P[l][m] = P[l-2][m]+(2*l-1)*cos(lat)*P[l-1][m-1];
-        P[l][l] = (2*l-1)*cos(lat)*P[l-1][l-1];
-    }
+    // Legendre Polynomials and their latitude derivatives
+    int dim = l_max+3;
+    double P[dim][dim], dP[dim][dim], ddP[dim][dim];
+    sph_legendre(SPH_GEODESY, in_grav_g ? 2 : 1, l_max, lat, dim, NULL, P, dP, ddP);
+    double sums[10];
     
     ///// ASPHERICAL ACCELERATION CALCULATION
     if (in_grav_a){
     
-        double dUdr = 0; // Doesn't take into account spherical term. Counted later in Propagation Function
-        double dUd0 = 0;
-        double dUdl = 0;
-    
         // Potential partial derivaties
-        for (int l = 2; l <=l_max_a ; ++l ){
-            for (int m = 0; m<=l; m++){
-                dUdr = dUdr + pow(a/r,l)*(l+1)*P[l][m]*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                dUd0 = dUd0 + pow(a/r,l)*(P[l][m+1]-m*tan(lat)*P[l][m])*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                dUdl = dUdl + pow(a/r,l)*m*P[l][m]*(S[l][m]*cos(m*lon)-C[l][m]*sin(m*lon));
-            }
-        }
+        sph_synthesis(1, 2, l_max_a, a/r, lon, dim, P, dP, ddP, 101, C, S, sums);
+        double dUdr = sums[1]; // Doesn't take into account spherical term. Counted later in Propagation Function
+        double dUd0 = sums[2];
+        double dUdl = sums[3];
         dUdr = -dUdr*mu/(r*r);
         dUd0 = dUd0*mu/r;
         dUdl = dUdl*mu/r;
+        
+        // Potential from the same harmonic sum (used for energy accounting)
+        if (U_gravity != NULL)
+            *U_gravity = -(1 + sums[0])*mu/r;
     
         ////// Acceleration in TEME Frame
         a_gravity_inertial[0] = (dUdr/r-p[2]/(r*r*sqrt(p[0]*p[0]+p[1]*p[1]))*dUd0)*p[0] - (dUdl/(p[0]*p[0]+p[1]*p[1]))*p[1];
@@ -222,31 +217,16 @@ void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3]
         }
     
         // First and Second partial derivatives
-        double dUdr = 1;   // Takes into account spherical term
-        double dUd0 = 0;
-        double dUdl = 0;
-        double d2Udr2 = 2; // Takes into account spherical term
-        double d2Ud02 = 0;
-        double d2Udl2 = 0;
-        double d2Ud0dr = 0;
-        double d2Udldr = 0;
-        double d2Udld0 = 0;
-    
-        for (int l = 2; l <=l_max_g ; ++l ){
-            for (int m = 0; m<=l; m++){
-                dUdr = dUdr + pow(a/r,l)*(l+1)*P[l][m]*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                dUd0 = dUd0 + pow(a/r,l)*(P[l][m+1]-m*tan(lat)*P[l][m])*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                dUdl = dUdl + pow(a/r,l)*m*P[l][m]*(S[l][m]*cos(m*lon)-C[l][m]*sin(m*lon));
-            
-                d2Udr2 = d2Udr2 + pow(a/r,l)*(l+1)*(l+2)*P[l][m]*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                d2Ud02 = d2Ud02 + pow(a/r,l)*(P[l][m+2]-(2*m+1)*tan(lat)*P[l][m+1]+m*(m*tan(lat)-(1/(cos(lat)*cos(lat))))*P[l][m])*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                d2Udl2 = d2Udl2 + pow(a/r,l)*m*m*P[l][m]*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-            
-                d2Ud0dr = d2Ud0dr + pow(a/r,l)*(l+1)*(P[l][m+1]-m*tan(lat)*P[l][m])*(C[l][m]*cos(m*lon)+S[l][m]*sin(m*lon));
-                d2Udldr = d2Udldr + pow(a/r,l)*m*(l+1)*P[l][m]*(S[l][m]*cos(m*lon)-C[l][m]*sin(m*lon));
-                d2Udld0 = d2Udld0 + pow(a/r,l)*m*(P[l][m+1]-m*tan(lat)*P[l][m])*(S[l][m]*cos(m*lon)-C[l][m]*sin(m*lon));
-            }
-        }
+        sph_synthesis(2, 2, l_max_g, a/r, lon, dim, P, dP, ddP, 101, C, S, sums);
+        double dUdr = 1 + sums[1];   // Takes into account spherical term
+        double dUd0 = sums[2];
+        double dUdl = sums[3];
+        double d2Udr2 = 2 + sums[4]; // Takes into account spherical term
+        double d2Ud02 = sums[5];
+        double d2Udl2 = sums[6];
+        double d2Ud0dr = sums[7];
+        double d2Udldr = sums[8];
+        double d2Udld0 = sums[9];
     
         dUdr = -dUdr*mu/(r*r);
         dUd0 = dUd0*mu/r;
@@ -271,13 +251,13 @@ void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3]
     
         // Rotate into body-fixed frame
         double dadr_b[3][3], G[3][3];
-        matrixmult(C_i2b,dadr,dadr_b);
+        mat3_mult(C_i2b,dadr,dadr_b);
         double C_b2i[3][3];
         for (int i=0; i<3; i++){
             for (int j=0; j<3; j++)
                 C_b2i[i][j] = C_i2b[j][i];
         }
-        matrixmult(dadr_b,C_b2i,G);
+        mat3_mult(dadr_b,C_b2i,G);
     
         // Gravity-Gradient Torque in body-fixed frame
         g_gravity_body[0] = G[1][2]*(Inertia[2][2]-Inertia[1][1]) - G[0][2]*Inertia[0][1] + G[0][1]*Inertia[0][2] + Inertia[1][2]*(G[1][1]-G[2][2]);
@@ -40,9 +40,15 @@
 //%                         non-spherical Earth in inertial frame
 //%                       double g_gravity_body[3]: gravity-gradient torque
 //%                         in body-fixed frame
+//%                       double *U_gravity: gravitational potential per unit
+//%                         mass up to l_max_a, including the spherical term
+//%                         (J kg-1), only computed with the acceleration and
+//%                         if not NULL
 //%
-//% COUPLING:             - matrixmult.c
+//% COUPLING:             - linalg.h
 //%                       - matxvec.c
+//%                       - sph_legendre.c
+//%                       - sph_synthesis.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -51,6 +57,6 @@
 
 #include <stdio.h>
 
-void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3][3], double Inertia[3][3], double C[101][101], double S[101][101], int l_max_a, int l_max_g, int in_grav_a, int in_grav_g, double a_gravity_inertial[3], double g_gravity_body[3]);
+void gravity_field(double p_ecef[3], double p[3], double LLA[4], double C_i2b[3][3], double Inertia[3][3], double C[101][101], double S[101][101], int l_max_a, int l_max_g, int in_grav_a, int in_grav_g, double a_gravity_inertial[3], double g_gravity_body[3], double *U_gravity);
 
 #endif /* gravity_field_h */
@@ -0,0 +1,142 @@
+//
+//  gravity_field_batch.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        gravity_field_batch.c
+//%
+//% DESCRIPTION:          This function calculates the gravitational acceleration
+//%                       from aspherical terms at many positions sharing the
+//%                       same epoch and coefficient set (ensembles, fragment
+//%                       clouds). Positions are processed in blocks of
+//%                       GRAV_BATCH_LANES and the degree steps of the
+//%                       spherical harmonic engine (sph_recurrence.h) run
+//%                       across the block, so that each C[l][m], S[l][m]
+//%                       pair is loaded once per block and the inner loops
+//%                       can be vectorized (SSE/AVX2/AVX-512 depending on
+//%                       compiler flags). Same expansion as gravity_field.c,
+//%                       singular at the poles
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n: number of positions
+//%                       double p_ecef[n][3]: positions in ECEF frame (m)
+//%                       double C[101][101]: gravity potential coefficients
+//%                       double S[101][101]: gravity potential coefficients
+//%                       int l_max: maximum order and degree in spherical
+//%                         harmonic expansion
+//%
+//% OUTPUT:               double a_ecef[n][3]: acceleration due to
+//%                         non-spherical Earth in ECEF frame (m/s^2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "gravity_field_batch.h"
+#include <math.h>
+#include "sph_recurrence.h"
+
+#define L GRAV_BATCH_LANES
+
+void gravity_field_batch(int n, double p_ecef[n][3], double C[101][101], double S[101][101], int l_max, double a_ecef[n][3]){
+    
+    // Constants
+    double mu = 3986004.418*pow(10,8);
+    double a = 6378136.3;
+    
+    for (int i0 = 0; i0 < n; i0 += L){
+        
+        // Number of valid lanes in this block, tail lanes repeat the last position
+        int n_lanes = (n-i0 < L) ? n-i0 : L;
+        
+        double x[L], y[L], z[L], r[L], rxy[L], sinlat[L], coslat[L], tanlat[L], rho[L], rhol[L];
+        for (int k = 0; k < L; k++){
+            int i = i0 + ((k < n_lanes) ? k : n_lanes-1);
+            x[k] = p_ecef[i][0];
+            y[k] = p_ecef[i][1];
+            z[k] = p_ecef[i][2];
+        }
+        
+        // Geocentric distance, latitude and longitude terms from coordinates (no trigonometric calls)
+        for (int k = 0; k < L; k++){
+            rxy[k] = sqrt(x[k]*x[k] + y[k]*y[k]);
+            r[k] = sqrt(x[k]*x[k] + y[k]*y[k] + z[k]*z[k]);
+            sinlat[k] = z[k]/r[k];
+            coslat[k] = rxy[k]/r[k];
+            tanlat[k] = z[k]/rxy[k];
+            rho[k] = a/r[k];
+            rhol[k] = rho[k];
+        }
+        
+        // cos(m*lon) and sin(m*lon) by angle addition
+        double cml[101][L], sml[101][L];
+        for (int k = 0; k < L; k++){
+            cml[0][k] = 1;
+            sml[0][k] = 0;
+            cml[1][k] = x[k]/rxy[k];
+            sml[1][k] = y[k]/rxy[k];
+        }
+        for (int m = 2; m <= l_max; m++){
+            for (int k = 0; k < L; k++){
+                cml[m][k] = cml[m-1][k]*cml[1][k] - sml[m-1][k]*sml[1][k];
+                sml[m][k] = sml[m-1][k]*cml[1][k] + cml[m-1][k]*sml[1][k];
+            }
+        }
+        
+        // Legendre Polynomials, only the last three degrees are kept (row l stored in P[l%3])
+        double P[3][103][L], dP[102][L];
+        for (int m = 0; m < 103; m++){
+            for (int k = 0; k < L; k++){
+                P[0][m][k] = 0;
+                P[1][m][k] = 0;
+                P[2][m][k] = 0;
+            }
+        }
+        for (int k = 0; k < L; k++){
+            P[0][0][k] = 1;
+            P[1][0][k] = sinlat[k];
+            P[1][1][k] = coslat[k];
+        }
+        
+        double dUdr[L], dUd0[L], dUdl[L];
+        for (int k = 0; k < L; k++){
+            dUdr[k] = 0;
+            dUd0[k] = 0;
+            dUdl[k] = 0;
+        }
+        
+        for (int l = 2; l <= l_max; l++){
+            
+            // Degree-l functions and latitude derivatives
+            sph_geodesy_degree(l, L, sinlat, coslat, &P[(l-2)%3][0][0], &P[(l-1)%3][0][0], &P[l%3][0][0]);
+            sph_geodesy_derivative(l, L, tanlat, &P[l%3][0][0], &dP[0][0]);
+            
+            // Degree-l partial sums, one coefficient load shared by all lanes
+            double s[10][L];
+            sph_degree_sums(l, 1, L, C[l], S[l], &cml[0][0], &sml[0][0], &P[l%3][0][0], &dP[0][0], NULL, &s[0][0]);
+            for (int k = 0; k < L; k++){
+                rhol[k] = rhol[k]*rho[k];
+                dUdr[k] = dUdr[k] + rhol[k]*(l+1)*s[0][k];
+                dUd0[k] = dUd0[k] + rhol[k]*s[2][k];
+                dUdl[k] = dUdl[k] + rhol[k]*s[3][k];
+            }
+        }
+        
+        // Acceleration in ECEF Frame
+        for (int k = 0; k < n_lanes; k++){
+            double dr = -dUdr[k]*mu/(r[k]*r[k]);
+            double d0 = dUd0[k]*mu/r[k];
+            double dl = dUdl[k]*mu/r[k];
+            a_ecef[i0+k][0] = (dr/r[k]-z[k]/(r[k]*r[k]*rxy[k])*d0)*x[k] - (dl/(rxy[k]*rxy[k]))*y[k];
+            a_ecef[i0+k][1] = (dr/r[k]-z[k]/(r[k]*r[k]*rxy[k])*d0)*y[k] + (dl/(rxy[k]*rxy[k]))*x[k];
+            a_ecef[i0+k][2] = dr/r[k]*z[k] + rxy[k]/(r[k]*r[k])*d0;
+        }
+    }
+    
+}
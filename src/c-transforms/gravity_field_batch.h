@@ -0,0 +1,51 @@
+//
+//  gravity_field_batch.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        gravity_field_batch.c
+//%
+//% DESCRIPTION:          This function calculates the gravitational acceleration
+//%                       from aspherical terms at many positions sharing the
+//%                       same epoch and coefficient set (ensembles, fragment
+//%                       clouds). Positions are processed in blocks of
+//%                       GRAV_BATCH_LANES and the degree steps of the
+//%                       spherical harmonic engine (sph_recurrence.h) run
+//%                       across the block, so that each C[l][m], S[l][m]
+//%                       pair is loaded once per block and the inner loops
+//%                       can be vectorized (SSE/AVX2/AVX-512 depending on
+//%                       compiler flags). Same expansion as gravity_field.c,
+//%                       singular at the poles
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n: number of positions
+//%                       double p_ecef[n][3]: positions in ECEF frame (m)
+//%                       double C[101][101]: gravity potential coefficients
+//%                       double S[101][101]: gravity potential coefficients
+//%                       int l_max: maximum order and degree in spherical
+//%                         harmonic expansion
+//%
+//% OUTPUT:               double a_ecef[n][3]: acceleration due to
+//%                         non-spherical Earth in ECEF frame (m/s^2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef gravity_field_batch_h
+#define gravity_field_batch_h
+
+#include <stdio.h>
+
+// Number of positions evaluated together (8 doubles = one AVX-512 register)
+#define GRAV_BATCH_LANES 8
+
+void gravity_field_batch(int n, double p_ecef[n][3], double C[101][101], double S[101][101], int l_max, double a_ecef[n][3]);
+
+#endif /* gravity_field_batch_h */
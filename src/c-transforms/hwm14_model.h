@@ -0,0 +1,89 @@
+//
+//  hwm14_model.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        hwm14_model.h
+//%
+//% DESCRIPTION:          This structure contains the coefficients of the
+//%                       native Horizontal Wind Model 2014 (quiet-time model,
+//%                       DWM07 disturbance winds and quasi-dipole coordinate
+//%                       conversion) loaded by load_hwm14.c and used by
+//%                       hwm14_native.c. It is not modified by the
+//%                       evaluation, so one model can be shared
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           Quiet-time model (data/hwm123114.bin):
+//%                       int nbf: number of basis functions per level
+//%                       int maxs, maxm, maxl, maxn: seasonal, stationary
+//%                         wave, tidal and latitudinal orders
+//%                       int nlev, p, nnode: B-spline levels, order and nodes
+//%                       int order[][8]: spectral content of each level
+//%                       int nb[]: number of basis functions of each level
+//%                       double vnode[]: altitude nodes (km)
+//%                       double *mparm, *tparm: zonal and meridional
+//%                         parameters (nbf per level)
+//%                       double alttns: transition altitude (km)
+//%                       double e1[5], e2[5]: top level continuation
+//%                       Disturbance wind model (data/dwm07b104i.dat):
+//%                       int dwm_nterm, dwm_nmax, dwm_mmax: number of terms,
+//%                         maximum degree and order
+//%                       int (*dwm_term)[3]: VSH, Kp and latitude weight
+//%                         index of each term (999 if none)
+//%                       double *dwm_coeff: term coefficients
+//%                       double twidth: high-latitude transition width (deg)
+//%                       Quasi-dipole coordinates (data/gd2qd.dat):
+//%                       int qd_nmax, qd_mmax, qd_nterm: maximum degree,
+//%                         order and number of terms
+//%                       double *qd_coeff[3]: x, y and z coefficients
+//%                       Normalized associated Legendre recursion:
+//%                       double anm, bnm, dnm, cm, en, marr, narr
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef hwm14_model_h
+#define hwm14_model_h
+
+#define HWM14_NMAX 16
+#define HWM14_NODES 64
+
+struct hwm14_model
+{
+    // Quiet-time model
+    int nbf, maxs, maxm, maxl, maxn;
+    int nlev, p, nnode;
+    int order[HWM14_NODES][8];
+    int nb[HWM14_NODES];
+    double vnode[HWM14_NODES];
+    double *mparm;
+    double *tparm;
+    double alttns;
+    double e1[5], e2[5];
+    
+    // Disturbance wind model
+    int dwm_nterm, dwm_nmax, dwm_mmax;
+    int (*dwm_term)[3];
+    double *dwm_coeff;
+    double twidth;
+    
+    // Quasi-dipole coordinates
+    int qd_nmax, qd_mmax, qd_nterm;
+    double *qd_coeff[3];
+    
+    // Associated Legendre normalization
+    double anm[HWM14_NMAX+1][HWM14_NMAX+1];
+    double bnm[HWM14_NMAX+1][HWM14_NMAX+1];
+    double dnm[HWM14_NMAX+1][HWM14_NMAX+1];
+    double cm[HWM14_NMAX+1];
+    double en[HWM14_NMAX+1];
+    double marr[HWM14_NMAX+1];
+    double narr[HWM14_NMAX+1];
+};
+
+#endif /* hwm14_model_h */
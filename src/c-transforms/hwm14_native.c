@@ -0,0 +1,506 @@
+//
+//  hwm14_native.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        hwm14_native.c
+//%
+//% DESCRIPTION:          This file contains a double-precision C version of
+//%                       the Horizontal Wind Model 2014 of hwm14.f90
+//%                       (quiet-time model of Drob et al. (2015) and DWM07
+//%                       disturbance winds of Emmert et al. (2008)). The
+//%                       state is explicit: the coefficients are read by
+//%                       load_hwm14.c and are not modified, and all other
+//%                       values are local, so calls are independent of the
+//%                       previous ones. hwm14_eval evaluates one point;
+//%                       hwm14_eval_batch evaluates points sharing the
+//%                       epoch and ap (an ensemble or fragment cloud at one
+//%                       time), with the seasonal, Kp and Sun direction
+//%                       terms computed once. The propagator has one point
+//%                       per call and uses hwm14_eval; the batch entry is
+//%                       for tools and ensemble drivers (hwm14_check.c)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct hwm14_model *hwm: model coefficients
+//%                       int iyd: year and day as yyddd
+//%                       double sec: universal time (s)
+//%                       double ap: current 3-hour ap index (disturbance
+//%                         winds not included if negative)
+//%                       double alt: altitude (km)
+//%                       double glat: geodetic latitude (deg)
+//%                       double glon: geodetic longitude (deg)
+//%                       int n: number of points (batch)
+//%
+//% OUTPUT:               double w[2]: meridional (northward) and zonal
+//%                         (eastward) wind (m s-1)
+//%
+//% COUPLING:             - hwm14_model.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "hwm14_native.h"
+#include <math.h>
+#include <string.h>
+
+#define N1 (HWM14_NMAX+1)
+
+static const double dtor = M_PI/180.0;
+
+// Terms depending only on the epoch and ap
+struct hwm14_epoch
+{
+    double fs[N1][2];   // seasonal harmonics
+    double ut;          // universal time (h)
+    int dwm;            // disturbance winds included?
+    double kp;          // Kp from ap
+    double kpterms[3];  // Kp spline terms
+    double asunqlon;    // quasi-dipole longitude of the anti-sunward direction (deg)
+};
+
+// Vector spherical harmonic basis functions (alfbasis in hwm14.f90)
+static void alfbasis(const struct hwm14_model *hwm, int nmax, int mmax, double theta, double P[N1][N1], double V[N1][N1], double W[N1][N1]){
+    
+    double x = cos(theta);
+    double y = sin(theta);
+    P[0][0] = 0.70710678118654746;
+    for (int m=1; m<=mmax; m++){
+        W[m][m] = hwm->cm[m]*P[m-1][m-1];
+        P[m][m] = y*hwm->en[m]*W[m][m];
+        double w_nm2 = 0;   // W(n-2,m) before scaling
+        for (int n=m+1; n<=nmax; n++){
+            double w_nm1 = W[n-1][m];
+            W[n][m] = hwm->anm[n][m]*x*w_nm1 - hwm->bnm[n][m]*w_nm2;
+            P[n][m] = y*hwm->en[n]*W[n][m];
+            V[n][m] = hwm->narr[n]*x*W[n][m] - hwm->dnm[n][m]*w_nm1;
+            w_nm2 = w_nm1;
+        }
+        for (int n=m; n<=nmax; n++)
+            W[n][m] = hwm->marr[m]*W[n][m];
+        V[m][m] = x*W[m][m];
+    }
+    P[1][0] = hwm->anm[1][0]*x*P[0][0];
+    V[1][0] = -P[1][1];
+    W[1][0] = 0;
+    for (int n=2; n<=nmax; n++){
+        P[n][0] = hwm->anm[n][0]*x*P[n-1][0] - hwm->bnm[n][0]*P[n-2][0];
+        V[n][0] = -P[n][1];
+        W[n][0] = 0;
+    }
+}
+
+// B-spline basis function i of order p at u (knots V[0..m])
+static double bspline(int p, int m, const double V[], int i, double u){
+    
+    double N[8];
+    if ((i == 0) && (u == V[0]))
+        return 1;
+    if ((i == m-p-1) && (u == V[m]))
+        return 1;
+    if ((u < V[i]) || (u >= V[i+p+1]))
+        return 0;
+    for (int j=0; j<=p; j++)
+        N[j] = ((u >= V[i+j]) && (u < V[i+j+1])) ? 1 : 0;
+    for (int k=1; k<=p; k++){
+        double saved = (N[0] == 0) ? 0 : ((u - V[i])*N[0])/(V[i+k] - V[i]);
+        for (int j=0; j<=p-k; j++){
+            double Vleft = V[i+j+1];
+            double Vright = V[i+j+k+1];
+            if (N[j+1] == 0){
+                N[j] = saved;
+                saved = 0;
+            }
+            else {
+                double temp = N[j+1]/(Vright - Vleft);
+                N[j] = saved + (Vright - u)*temp;
+                saved = (u - Vleft)*temp;
+            }
+        }
+    }
+    return N[0];
+}
+
+// Knot span of u
+static int findspan(int n, int p, double u, const double V[]){
+    
+    if (u >= V[n+1])
+        return n;
+    int low = p, high = n+1, mid = (low + high)/2;
+    while ((u < V[mid]) || (u >= V[mid+1])){
+        if (u < V[mid])
+            high = mid;
+        else
+            low = mid;
+        mid = (low + high)/2;
+    }
+    return mid;
+}
+
+// Vertical weights of levels iz to iz+3 (vertwght in hwm14.f90)
+static int vertwght(const struct hwm14_model *hwm, double alt, double wght[4]){
+    
+    int p = hwm->p, m = hwm->nnode;
+    const double *V = hwm->vnode;
+    int iz = findspan(m-p-1, p, alt, V) - p;
+    if (iz > 26)
+        iz = 26;
+    wght[0] = bspline(p, m, V, iz, alt);
+    wght[1] = bspline(p, m, V, iz+1, alt);
+    if (iz <= 25){
+        wght[2] = bspline(p, m, V, iz+2, alt);
+        wght[3] = bspline(p, m, V, iz+3, alt);
+        return iz;
+    }
+    double we[5] = {0, 0, 0, 0, 0};
+    if (alt > hwm->alttns){
+        we[3] = exp(-(alt - hwm->alttns)/60.0);
+        we[4] = 1;
+    }
+    else {
+        we[0] = bspline(p, m, V, iz+2, alt);
+        we[1] = bspline(p, m, V, iz+3, alt);
+        we[2] = bspline(p, m, V, iz+4, alt);
+    }
+    wght[2] = 0;
+    wght[3] = 0;
+    for (int k=0; k<5; k++){
+        wght[2] = wght[2] + we[k]*hwm->e1[k];
+        wght[3] = wght[3] + we[k]*hwm->e2[k];
+    }
+    return iz;
+}
+
+// Basis functions of a level with the given spectral content
+static int qwm_basis(const int order[8], double theta, const double fs[N1][2], const double fm[N1][2], const double fl[N1][2], double gv[N1][N1], double gw[N1][N1], double bz[]){
+    
+    int amaxs = order[0], amaxn = order[1];
+    int c = 0;
+    
+    // Seasonal - zonal average (m = 0)
+    for (int n=1; n<=amaxn; n++){
+        bz[c] = -sin(n*theta);
+        bz[c+1] = sin(n*theta);
+        c = c + 2;
+    }
+    for (int s=1; s<=amaxs; s++){
+        double cs = fs[s][0], ss = fs[s][1];
+        for (int n=1; n<=amaxn; n++){
+            double sc = sin(n*theta);
+            bz[c] = -sc*cs;
+            bz[c+1] = sc*ss;
+            bz[c+2] = sc*cs;
+            bz[c+3] = -sc*ss;
+            c = c + 4;
+        }
+    }
+    
+    // Stationary planetary waves (j = 0, longitude) and migrating solar
+    // tides (j = 1, local time)
+    for (int j=0; j<2; j++){
+        int maxk = order[2+3*j], maxs = order[3+3*j], maxn = order[4+3*j];
+        const double (*fk)[2] = (j == 0) ? fm : fl;
+        for (int m=1; m<=maxk; m++){
+            double cm = fk[m][0], sm = fk[m][1];
+            for (int n=m; n<=maxn; n++){
+                double vb = gv[n][m], wb = gw[n][m];
+                bz[c] = -vb*cm;
+                bz[c+1] = vb*sm;
+                bz[c+2] = -wb*sm;
+                bz[c+3] = -wb*cm;
+                c = c + 4;
+            }
+            for (int s=1; s<=maxs; s++){
+                double cs = fs[s][0], ss = fs[s][1];
+                for (int n=m; n<=maxn; n++){
+                    double vb = gv[n][m], wb = gw[n][m];
+                    bz[c] = -vb*cm*cs;
+                    bz[c+1] = vb*sm*cs;
+                    bz[c+2] = -wb*sm*cs;
+                    bz[c+3] = -wb*cm*cs;
+                    bz[c+4] = -vb*cm*ss;
+                    bz[c+5] = vb*sm*ss;
+                    bz[c+6] = -wb*sm*ss;
+                    bz[c+7] = -wb*cm*ss;
+                    c = c + 8;
+                }
+            }
+        }
+    }
+    return c;
+}
+
+// Quiet-time winds (hwmqt in hwm14.f90)
+static void hwmqt(const struct hwm14_model *hwm, const struct hwm14_epoch *ep, double alt, double glat, double glon, double gv[N1][N1], double gw[N1][N1], double w[2]){
+    
+    double fm[N1][2], fl[N1][2], bz[hwm->nbf];
+    
+    // Local time and longitude harmonics
+    double BB = fmod(ep->ut + glon/15.0 + 48.0, 24.0)*2*M_PI/24.0;
+    for (int l=0; l<=hwm->maxl; l++){
+        fl[l][0] = cos(l*BB);
+        fl[l][1] = sin(l*BB);
+    }
+    for (int m=0; m<=hwm->maxm; m++){
+        fm[m][0] = cos(m*glon*dtor);
+        fm[m][1] = sin(m*glon*dtor);
+    }
+    double theta = (90.0 - glat)*dtor;
+    
+    // Vertical weights
+    double zwght[4];
+    int lev = vertwght(hwm, alt, zwght);
+    
+    // Sum over levels (basis functions rebuilt only if the content changes)
+    double u = 0, v = 0;
+    const int *built = NULL;
+    int c = 0;
+    for (int b=0; b<=3; b++){
+        if (zwght[b] == 0)
+            continue;
+        int d = b + lev;
+        if ((built == NULL) || (memcmp(built, hwm->order[d], sizeof(hwm->order[d])) != 0)){
+            c = qwm_basis(hwm->order[d], theta, ep->fs, fm, fl, gv, gw, bz);
+            built = hwm->order[d];
+        }
+        const double *mparm = &hwm->mparm[(size_t)d*hwm->nbf];
+        const double *tparm = &hwm->tparm[(size_t)d*hwm->nbf];
+        double su = 0, sv = 0;
+        for (int k=0; k<c; k++){
+            su = su + bz[k]*mparm[k];
+            sv = sv + bz[k]*tparm[k];
+        }
+        u = u + zwght[b]*su;
+        v = v + zwght[b]*sv;
+    }
+    
+    w[0] = v;
+    w[1] = u;
+}
+
+// Spherical harmonic synthesis of the quasi-dipole expansion; grad_theta and
+// grad_phi are only computed if not NULL
+static void qd_synthesis(const struct hwm14_model *hwm, double phi, double P[N1][N1], double V[N1][N1], double W[N1][N1], double xyz[3], double grad_theta[3], double grad_phi[3]){
+    
+    for (int k=0; k<3; k++){
+        xyz[k] = 0;
+        if (grad_theta != NULL){
+            grad_theta[k] = 0;
+            grad_phi[k] = 0;
+        }
+    }
+    int i = 0;
+    for (int m=0; m<=hwm->qd_mmax; m++){
+        double cosmphi = cos(m*phi), sinmphi = sin(m*phi);
+        for (int n=m; n<=hwm->qd_nmax; n++){
+            double normadj = sqrt((double)(n*(n+1)));
+            for (int k=0; k<3; k++){
+                const double *coeff = hwm->qd_coeff[k];
+                if (m == 0){
+                    xyz[k] = xyz[k] + P[n][0]*coeff[i];
+                    if (grad_theta != NULL)
+                        grad_theta[k] = grad_theta[k] + V[n][0]*normadj*coeff[i];
+                }
+                else {
+                    xyz[k] = xyz[k] + P[n][m]*(cosmphi*coeff[i] + sinmphi*coeff[i+1]);
+                    if (grad_theta != NULL){
+                        grad_theta[k] = grad_theta[k] + V[n][m]*normadj*(cosmphi*coeff[i] + sinmphi*coeff[i+1]);
+                        grad_phi[k] = grad_phi[k] + W[n][m]*normadj*(-sinmphi*coeff[i] + cosmphi*coeff[i+1]);
+                    }
+                }
+            }
+            i = i + ((m == 0) ? 1 : 2);
+        }
+    }
+}
+
+// Quasi-dipole latitude and longitude (deg) and base vectors (gd2qd in
+// hwm14.f90), from the Legendre functions at the geodetic latitude
+static void gd2qd(const struct hwm14_model *hwm, double glon, double gp[N1][N1], double gv[N1][N1], double gw[N1][N1], double *qlat, double *qlon, double f[4]){
+    
+    double xyz[3], gt[3], gph[3];
+    qd_synthesis(hwm, glon*dtor, gp, gv, gw, xyz, gt, gph);
+    
+    double qlonrad = atan2(xyz[1], xyz[0]);
+    double cosqlon = cos(qlonrad);
+    double sinqlon = sin(qlonrad);
+    double cosqlat = xyz[0]*cosqlon + xyz[1]*sinqlon;
+    *qlat = atan2(xyz[2], cosqlat)/dtor;
+    *qlon = qlonrad/dtor;
+    
+    // f1e, f1n, f2e, f2n
+    f[0] = -gt[2]*cosqlat + (gt[0]*cosqlon + gt[1]*sinqlon)*xyz[2];
+    f[1] = -gph[2]*cosqlat + (gph[0]*cosqlon + gph[1]*sinqlon)*xyz[2];
+    f[2] = gt[1]*cosqlon - gt[0]*sinqlon;
+    f[3] = gph[1]*cosqlon - gph[0]*sinqlon;
+}
+
+// Kp from ap (ap2kp in hwm14.f90)
+static double ap2kp(double ap){
+    
+    static const double apgrid[28] = {0,2,3,4,5,6,7,9,12,15,18,22,27,32,39,48,56,67,80,94,111,132,154,179,207,236,300,400};
+    if (ap < 0)
+        ap = 0;
+    if (ap > 400)
+        ap = 400;
+    int i = 1;
+    while (ap > apgrid[i])
+        i++;
+    if (ap == apgrid[i])
+        return i/3.0;
+    return (i-1)/3.0 + (ap - apgrid[i-1])/(3.0*(apgrid[i] - apgrid[i-1]));
+}
+
+// Quadratic B-spline terms in Kp (kpspl3 in hwm14.f90)
+static void kpspl3(double kp, double kpterms[3]){
+    
+    static const double node[8] = {-10, -8, 0, 2, 5, 8, 18, 20};
+    double x = fmin(fmax(kp, 0), 8), kpspl[7];
+    for (int i=0; i<7; i++)
+        kpspl[i] = ((x >= node[i]) && (x < node[i+1])) ? 1 : 0;
+    for (int j=2; j<=3; j++){
+        for (int i=0; i<=8-j-1; i++)
+            kpspl[i] = kpspl[i]*(x - node[i])/(node[i+j-1] - node[i]) + kpspl[i+1]*(node[i+j] - x)/(node[i+j] - node[i+1]);
+    }
+    kpterms[0] = kpspl[0] + kpspl[1];
+    kpterms[1] = kpspl[2];
+    kpterms[2] = kpspl[3] + kpspl[4];
+}
+
+// Epoch terms: seasonal harmonics, Kp and quasi-dipole longitude of the
+// anti-sunward direction (mltcalc in hwm14.f90)
+static void hwm14_epoch_terms(const struct hwm14_model *hwm, int iyd, double sec, double ap, struct hwm14_epoch *ep){
+    
+    double day = iyd % 1000;
+    double AA = day*2*M_PI/365.25;
+    for (int s=0; s<=hwm->maxs; s++){
+        ep->fs[s][0] = cos(s*AA);
+        ep->fs[s][1] = sin(s*AA);
+    }
+    ep->ut = sec/3600.0;
+    ep->dwm = (ap >= 0);
+    if (!ep->dwm)
+        return;
+    ep->kp = ap2kp(ap);
+    kpspl3(ep->kp, ep->kpterms);
+    
+    double sineps = 0.39781868;
+    double asunglat = -asin(sin((day + ep->ut/24.0 - 80.0)*dtor)*sineps)/dtor;
+    double asunglon = -ep->ut*15.0;
+    double sp[N1][N1], sv[N1][N1], sw[N1][N1], xyz[3];
+    alfbasis(hwm, hwm->qd_nmax, hwm->qd_mmax, (90.0 - asunglat)*dtor, sp, sv, sw);
+    qd_synthesis(hwm, asunglon*dtor, sp, sv, sw, xyz, NULL, NULL);
+    ep->asunqlon = atan2(xyz[1], xyz[0])/dtor;
+}
+
+// Disturbance winds in quasi-dipole coordinates (dwm07b in hwm14.f90)
+static void dwm07b(const struct hwm14_model *hwm, const struct hwm14_epoch *ep, double mlt, double mlat, double *mmpwind, double *mzpwind){
+    
+    int nmax = hwm->dwm_nmax, mmax = hwm->dwm_mmax;
+    double dp[N1][N1], dv[N1][N1], dw[N1][N1], mltterms[N1][2];
+    alfbasis(hwm, nmax, mmax, (90.0 - mlat)*dtor, dp, dv, dw);
+    double phi = mlt*dtor*15.0;
+    for (int m=0; m<=mmax; m++){
+        mltterms[m][0] = cos(m*phi);
+        mltterms[m][1] = sin(m*phi);
+    }
+    
+    // Vector spherical harmonic terms
+    int nvsh = (((nmax+1)*(nmax+2) - (nmax-mmax)*(nmax-mmax+1))/2 - 1)*4 - 2*nmax;
+    double vsh[nvsh][2];
+    int i = 0;
+    for (int n=1; n<=nmax; n++){
+        vsh[i][0] = -dv[n][0]*mltterms[0][0];
+        vsh[i+1][0] = dw[n][0]*mltterms[0][0];
+        vsh[i][1] = -vsh[i+1][0];
+        vsh[i+1][1] = vsh[i][0];
+        i = i + 2;
+        for (int m=1; (m<=mmax) && (m<=n); m++){
+            vsh[i][0] = -dv[n][m]*mltterms[m][0];
+            vsh[i+1][0] = dv[n][m]*mltterms[m][1];
+            vsh[i+2][0] = dw[n][m]*mltterms[m][1];
+            vsh[i+3][0] = dw[n][m]*mltterms[m][0];
+            vsh[i][1] = -vsh[i+2][0];
+            vsh[i+1][1] = -vsh[i+3][0];
+            vsh[i+2][1] = vsh[i][0];
+            vsh[i+3][1] = vsh[i+1][0];
+            i = i + 4;
+        }
+    }
+    
+    // Latitudinal weighting (latwgt2 in hwm14.f90)
+    static const double lw[6] = {65.7633, -4.60256, -3.53915, -1.99971, -0.752193, 0.972388};
+    double mltrad = mlt*15.0*dtor;
+    double kp = fmin(fmax(ep->kp, 0), 8);
+    double tlat = lw[0] + lw[1]*cos(mltrad) + lw[2]*sin(mltrad) + kp*(lw[3] + lw[4]*cos(mltrad) + lw[5]*sin(mltrad));
+    double latwgt = 1.0/(1 + exp(-(fabs(mlat) - tlat)/hwm->twidth));
+    
+    // Coupled terms
+    *mmpwind = 0;
+    *mzpwind = 0;
+    for (int k=0; k<hwm->dwm_nterm; k++){
+        double t[2] = {1, 1};
+        const int *term = hwm->dwm_term[k];
+        if (term[0] != 999){
+            t[0] = t[0]*vsh[term[0]][0];
+            t[1] = t[1]*vsh[term[0]][1];
+        }
+        if (term[1] != 999){
+            t[0] = t[0]*ep->kpterms[term[1]];
+            t[1] = t[1]*ep->kpterms[term[1]];
+        }
+        if (term[2] != 999){
+            t[0] = t[0]*latwgt;
+            t[1] = t[1]*latwgt;
+        }
+        *mmpwind = *mmpwind + hwm->dwm_coeff[k]*t[0];
+        *mzpwind = *mzpwind + hwm->dwm_coeff[k]*t[1];
+    }
+}
+
+// Quiet-time plus disturbance winds at one point
+static void hwm14_point(const struct hwm14_model *hwm, const struct hwm14_epoch *ep, double alt, double glat, double glon, double w[2]){
+    
+    // Legendre functions at the geodetic latitude (shared by the quiet-time
+    // model and the quasi-dipole conversion)
+    double gp[N1][N1], gv[N1][N1], gw[N1][N1];
+    int nmax = (hwm->maxn > hwm->qd_nmax) ? hwm->maxn : hwm->qd_nmax;
+    int mmax = (hwm->maxm > hwm->qd_mmax) ? hwm->maxm : hwm->qd_mmax;
+    alfbasis(hwm, nmax, mmax, (90.0 - glat)*dtor, gp, gv, gw);
+    
+    hwmqt(hwm, ep, alt, glat, glon, gv, gw, w);
+    
+    if (ep->dwm){
+        
+        // Quasi-dipole coordinates and magnetic local time
+        double mlat, mlon, f[4];
+        gd2qd(hwm, glon, gp, gv, gw, &mlat, &mlon, f);
+        double mlt = (mlon - ep->asunqlon)/15.0;
+        
+        // Disturbance winds in geographic coordinates with height profile
+        double mmpwind, mzpwind;
+        dwm07b(hwm, ep, mlt, mlat, &mmpwind, &mzpwind);
+        double profile = 1 + exp(-(alt - 125.0)/hwm->twidth);
+        w[0] = w[0] + (f[3]*mmpwind + f[1]*mzpwind)/profile;
+        w[1] = w[1] + (f[2]*mmpwind + f[0]*mzpwind)/profile;
+    }
+}
+
+void hwm14_eval(const struct hwm14_model *hwm, int iyd, double sec, double ap, double alt, double glat, double glon, double w[2]){
+    
+    struct hwm14_epoch ep;
+    hwm14_epoch_terms(hwm, iyd, sec, ap, &ep);
+    hwm14_point(hwm, &ep, alt, glat, glon, w);
+}
+
+void hwm14_eval_batch(const struct hwm14_model *hwm, int iyd, double sec, double ap, int n, double alt[n], double glat[n], double glon[n], double w[n][2]){
+    
+    struct hwm14_epoch ep;
+    hwm14_epoch_terms(hwm, iyd, sec, ap, &ep);
+    for (int i=0; i<n; i++)
+        hwm14_point(hwm, &ep, alt[i], glat[i], glon[i], w[i]);
+}
@@ -0,0 +1,56 @@
+//
+//  hwm14_native.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        hwm14_native.c
+//%
+//% DESCRIPTION:          This file contains a double-precision C version of
+//%                       the Horizontal Wind Model 2014 of hwm14.f90
+//%                       (quiet-time model of Drob et al. (2015) and DWM07
+//%                       disturbance winds of Emmert et al. (2008)). The
+//%                       state is explicit: the coefficients are read by
+//%                       load_hwm14.c and are not modified, and all other
+//%                       values are local, so calls are independent of the
+//%                       previous ones. hwm14_eval evaluates one point;
+//%                       hwm14_eval_batch evaluates points sharing the
+//%                       epoch and ap (an ensemble or fragment cloud at one
+//%                       time), with the seasonal, Kp and Sun direction
+//%                       terms computed once. The propagator has one point
+//%                       per call and uses hwm14_eval; the batch entry is
+//%                       for tools and ensemble drivers (hwm14_check.c)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct hwm14_model *hwm: model coefficients
+//%                       int iyd: year and day as yyddd
+//%                       double sec: universal time (s)
+//%                       double ap: current 3-hour ap index (disturbance
+//%                         winds not included if negative)
+//%                       double alt: altitude (km)
+//%                       double glat: geodetic latitude (deg)
+//%                       double glon: geodetic longitude (deg)
+//%                       int n: number of points (batch)
+//%
+//% OUTPUT:               double w[2]: meridional (northward) and zonal
+//%                         (eastward) wind (m s-1)
+//%
+//% COUPLING:             - hwm14_model.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef hwm14_native_h
+#define hwm14_native_h
+
+#include <stdio.h>
+#include "hwm14_model.h"
+
+void hwm14_eval(const struct hwm14_model *hwm, int iyd, double sec, double ap, double alt, double glat, double glon, double w[2]);
+void hwm14_eval_batch(const struct hwm14_model *hwm, int iyd, double sec, double ap, int n, double alt[n], double glat[n], double glon[n], double w[n][2]);
+
+#endif /* hwm14_native_h */
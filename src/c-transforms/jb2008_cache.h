@@ -0,0 +1,57 @@
+//
+//  jb2008_cache.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        jb2008_cache.h
+//%
+//% DESCRIPTION:          This structure contains the epoch-dependent inputs
+//%                       of JB2008 of the last epoch requested from
+//%                       jb2008_epoch.c, shared by all integrator stages of
+//%                       a step. They are keyed on the epoch and on the
+//%                       space-weather store (valid must be reset to 0 if
+//%                       the store is reloaded in place)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int jb2008_cache.valid: 1 if the inputs are set
+//%                       const struct space_weather *jb2008_cache.sw:
+//%                         space-weather store of the inputs
+//%                       double jb2008_cache.D1950: epoch (days since
+//%                         January 0, 1950, 00:00:00 UTC)
+//%                       double jb2008_cache.sol[8]: F10, F10B, S10, S10B,
+//%                         M10, M10B, Y10, Y10B (sfu)
+//%                       double jb2008_cache.DSTDTC: temperature change
+//%                         from Dst (K)
+//%                       double jb2008_cache.GWRAS: Greenwich right
+//%                         ascension (rad)
+//%                       double jb2008_cache.SUN[2]: Sun right ascension
+//%                         and declination (rad)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef jb2008_cache_h
+#define jb2008_cache_h
+
+#include "space_weather.h"
+
+struct jb2008_cache
+{
+    // Epoch and space-weather store of the inputs
+    int valid;
+    const struct space_weather *sw;
+    double D1950;
+    
+    // Inputs of JB2008
+    double sol[8];
+    double DSTDTC;
+    double GWRAS;
+    double SUN[2];
+};
+
+#endif /* jb2008_cache_h */
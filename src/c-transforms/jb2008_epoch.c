@@ -0,0 +1,70 @@
+//
+//  jb2008_epoch.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        jb2008_epoch.c
+//%
+//% DESCRIPTION:          This function returns the epoch-dependent inputs of
+//%                       JB2008 (lagged solar indices, storm temperature,
+//%                       Greenwich right ascension and Sun position). They
+//%                       are kept in the cache from the previous call if the
+//%                       epoch and the space-weather store have not changed,
+//%                       which is the case for all stages of an integration
+//%                       step
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct jb2008_cache *jc: inputs of the last epoch
+//%                       const struct space_weather *sw: space-weather store
+//%                       double D1950: days since January 0, 1950, 00:00:00 UTC
+//%
+//% OUTPUT:               double sol[8]: F10, F10B, S10, S10B, M10, M10B, Y10,
+//%                         Y10B (sfu)
+//%                       double *DSTDTC: temperature change from Dst (K)
+//%                       double *GWRAS: Greenwich right ascension (rad)
+//%                       double SUN[2]: Sun right ascension and declination
+//%                         (rad)
+//%
+//% COUPLING:             - space_weather_jb2008.c
+//%                       - JB2008.for (THETA, SUNPOS)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "jb2008_epoch.h"
+#include "space_weather_jb2008.h"
+
+extern void theta_(double *xD1950, double *GWRAS);
+extern void sunpos_(double *AMJD, double *SOLRAS, double *SOLDEC);
+
+void jb2008_epoch(struct jb2008_cache *jc, const struct space_weather *sw, double D1950, double sol[8], double *DSTDTC, double *GWRAS, double SUN[2]){
+    
+    // New epoch or space-weather store
+    if (!jc->valid || D1950 != jc->D1950 || sw != jc->sw){
+        
+        space_weather_jb2008(sw, D1950, jc->sol, &jc->DSTDTC);
+        
+        double xD1950 = D1950;
+        theta_(&xD1950,&jc->GWRAS);
+        
+        double AMJD = D1950 + 33281.0;
+        sunpos_(&AMJD,&jc->SUN[0],&jc->SUN[1]);
+        
+        jc->sw = sw;
+        jc->D1950 = D1950;
+        jc->valid = 1;
+    }
+    
+    for (int i=0; i<8; i++)
+        sol[i] = jc->sol[i];
+    *DSTDTC = jc->DSTDTC;
+    *GWRAS = jc->GWRAS;
+    SUN[0] = jc->SUN[0];
+    SUN[1] = jc->SUN[1];
+    
+}
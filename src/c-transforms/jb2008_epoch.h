@@ -0,0 +1,48 @@
+//
+//  jb2008_epoch.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        jb2008_epoch.c
+//%
+//% DESCRIPTION:          This function returns the epoch-dependent inputs of
+//%                       JB2008 (lagged solar indices, storm temperature,
+//%                       Greenwich right ascension and Sun position). They
+//%                       are kept in the cache from the previous call if the
+//%                       epoch and the space-weather store have not changed,
+//%                       which is the case for all stages of an integration
+//%                       step
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct jb2008_cache *jc: inputs of the last epoch
+//%                       const struct space_weather *sw: space-weather store
+//%                       double D1950: days since January 0, 1950, 00:00:00 UTC
+//%
+//% OUTPUT:               double sol[8]: F10, F10B, S10, S10B, M10, M10B, Y10,
+//%                         Y10B (sfu)
+//%                       double *DSTDTC: temperature change from Dst (K)
+//%                       double *GWRAS: Greenwich right ascension (rad)
+//%                       double SUN[2]: Sun right ascension and declination
+//%                         (rad)
+//%
+//% COUPLING:             - space_weather_jb2008.c
+//%                       - JB2008.for (THETA, SUNPOS)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef jb2008_epoch_h
+#define jb2008_epoch_h
+
+#include <stdio.h>
+#include "space_weather.h"
+#include "jb2008_cache.h"
+
+void jb2008_epoch(struct jb2008_cache *jc, const struct space_weather *sw, double D1950, double sol[8], double *DSTDTC, double *GWRAS, double SUN[2]);
+
+#endif /* jb2008_epoch_h */
@@ -0,0 +1,38 @@
+//
+//  leap_seconds.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        leap_seconds.c
+//%
+//% DESCRIPTION:          This function returns TAI-UTC at a UTC epoch from
+//%                       the leap second table (searched from the most
+//%                       recent entry)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct time_scales *ts: leap second table
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double dat: TAI-UTC (s)
+//%
+//% COUPLING:             - time_scales.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "leap_seconds.h"
+
+double leap_seconds(const struct time_scales *ts, double t2000utc){
+    
+    int i = ts->n_leap-1;
+    while ((i > 0) && (t2000utc < ts->leap_t2000utc[i]))
+        i--;
+    
+    return ts->leap_dat[i];
+    
+}
@@ -0,0 +1,36 @@
+//
+//  leap_seconds.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        leap_seconds.c
+//%
+//% DESCRIPTION:          This function returns TAI-UTC at a UTC epoch from
+//%                       the leap second table (searched from the most
+//%                       recent entry)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct time_scales *ts: leap second table
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double dat: TAI-UTC (s)
+//%
+//% COUPLING:             - time_scales.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef leap_seconds_h
+#define leap_seconds_h
+
+#include <stdio.h>
+#include "time_scales.h"
+
+double leap_seconds(const struct time_scales *ts, double t2000utc);
+
+#endif /* leap_seconds_h */
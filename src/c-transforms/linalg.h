@@ -0,0 +1,106 @@
+//
+//  linalg.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        linalg.h
+//%
+//% DESCRIPTION:          This header contains inline versions of the 3-vector,
+//%                       3x3 matrix and quaternion operations used in the
+//%                       force and torque models (dotprod.c, crossprod.c,
+//%                       norm.c, vectors2angle.c, matxvec.c, matrixmult.c,
+//%                       transpose.c, quat2dcm.c), so that they are expanded
+//%                       in the per-surface loops instead of being called.
+//%                       The inverse of a rotation matrix is its transpose
+//%                       (mat3_transpose or mat3t_vec) instead of invertmat.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% FUNCTIONS:            double vec3_dot(a, b): a.b
+//%                       void vec3_cross(a, b, axb): a x b
+//%                       double vec3_norm(v): |v|
+//%                       double vec3_angle(a, b): angle between a and b (rad)
+//%                       void mat3_vec(A, b, Ab): A b
+//%                       void mat3t_vec(A, b, Atb): A^T b
+//%                       void mat3_mult(A, B, AB): A B
+//%                       void mat3_transpose(A, At): A^T
+//%                       void quat_dcm(q, dcm): rotation matrix of the
+//%                         quaternion q (scalar first), q is normalized
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef linalg_h
+#define linalg_h
+
+#include <math.h>
+
+static inline double vec3_dot(double a[3], double b[3]){
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static inline void vec3_cross(double a[3], double b[3], double axb[3]){
+    axb[0] = a[1]*b[2] - a[2]*b[1];
+    axb[1] = a[2]*b[0] - a[0]*b[2];
+    axb[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+static inline double vec3_norm(double v[3]){
+    return sqrt(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+
+static inline double vec3_angle(double a[3], double b[3]){
+    double axb[3];
+    vec3_cross(a, b, axb);
+    return atan2(vec3_norm(axb), vec3_dot(a, b));
+}
+
+static inline void mat3_vec(double A[3][3], double b[3], double Ab[3]){
+    Ab[0] = A[0][0]*b[0] + A[0][1]*b[1] + A[0][2]*b[2];
+    Ab[1] = A[1][0]*b[0] + A[1][1]*b[1] + A[1][2]*b[2];
+    Ab[2] = A[2][0]*b[0] + A[2][1]*b[1] + A[2][2]*b[2];
+}
+
+static inline void mat3t_vec(double A[3][3], double b[3], double Atb[3]){
+    Atb[0] = A[0][0]*b[0] + A[1][0]*b[1] + A[2][0]*b[2];
+    Atb[1] = A[0][1]*b[0] + A[1][1]*b[1] + A[2][1]*b[2];
+    Atb[2] = A[0][2]*b[0] + A[1][2]*b[1] + A[2][2]*b[2];
+}
+
+static inline void mat3_mult(double A[3][3], double B[3][3], double AB[3][3]){
+    for (int i=0; i<3; i++){
+        for (int j=0; j<3; j++)
+            AB[i][j] = A[i][0]*B[0][j] + A[i][1]*B[1][j] + A[i][2]*B[2][j];
+    }
+}
+
+static inline void mat3_transpose(double A[3][3], double At[3][3]){
+    for (int i=0; i<3; i++){
+        for (int j=0; j<3; j++)
+            At[i][j] = A[j][i];
+    }
+}
+
+static inline void quat_dcm(double q[4], double dcm[3][3]){
+    double n = sqrt(q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]);
+    for (int i=0; i<4; i++)
+        q[i] = q[i]/n;
+    double q00 = q[0]*q[0], q11 = q[1]*q[1], q22 = q[2]*q[2], q33 = q[3]*q[3];
+    dcm[0][0] = q00 + q11 - q22 - q33;
+    dcm[0][1] = 2*(q[1]*q[2] + q[0]*q[3]);
+    dcm[0][2] = 2*(q[1]*q[3] - q[0]*q[2]);
+    dcm[1][0] = 2*(q[1]*q[2] - q[0]*q[3]);
+    dcm[1][1] = q00 - q11 + q22 - q33;
+    dcm[1][2] = 2*(q[2]*q[3] + q[0]*q[1]);
+    dcm[2][0] = 2*(q[1]*q[3] + q[0]*q[2]);
+    dcm[2][1] = 2*(q[2]*q[3] - q[0]*q[1]);
+    dcm[2][2] = q00 - q11 - q22 + q33;
+}
+
+#endif /* linalg_h */
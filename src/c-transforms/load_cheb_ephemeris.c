@@ -0,0 +1,84 @@
+//
+//  load_cheb_ephemeris.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_cheb_ephemeris.c
+//%
+//% DESCRIPTION:          This function memory-maps a binary Chebyshev
+//%                       ephemeris file written by eph2cheb and checks its
+//%                       header. Nothing is parsed or copied: the pages are
+//%                       read on demand by cheb_eval.c, and the mapping
+//%                       (map, map_size) is released by
+//%                       unload_cheb_ephemeris.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const char *file: binary ephemeris file
+//%
+//% OUTPUT:               struct cheb_ephemeris *eph: mapped ephemeris
+//%
+//% COUPLING:             - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_cheb_ephemeris.h"
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+void load_cheb_ephemeris(const char *file, struct cheb_ephemeris *eph){
+    
+    int errnum;
+    
+    int fd = open(file, O_RDONLY);
+    if (fd < 0){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\nRun 'make ephemeris' to generate it from the text ephemerides\n\n", file, strerror( errnum ));
+        exit(-1);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(struct cheb_header)){
+        fprintf(stderr, "\nError in '%s': file too short for a Chebyshev ephemeris\n\n", file);
+        exit(-1);
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED){
+        errnum = errno;
+        fprintf(stderr, "\nError mapping file '%s': %s\n\n", file, strerror( errnum ));
+        exit(-1);
+    }
+    close(fd);
+    
+    // Check header
+    struct cheb_header hdr;
+    memcpy(&hdr, map, sizeof(hdr));
+    if (strncmp(hdr.magic, CHEB_MAGIC, sizeof(hdr.magic)) != 0 || hdr.version != CHEB_VERSION || hdr.n_comp != 3){
+        fprintf(stderr, "\nError in '%s': not a version %d Chebyshev ephemeris for this machine\n\n", file, CHEB_VERSION);
+        exit(-1);
+    }
+    size_t expected = sizeof(struct cheb_header) + (size_t)hdr.n_seg*hdr.n_comp*hdr.n_coef*sizeof(double);
+    if (hdr.n_seg <= 0 || hdr.n_coef <= 0 || hdr.seg_len <= 0 || (size_t)st.st_size != expected){
+        fprintf(stderr, "\nError in '%s': inconsistent Chebyshev ephemeris header\n\n", file);
+        exit(-1);
+    }
+    
+    eph->t_start = hdr.t_start;
+    eph->seg_len = hdr.seg_len;
+    eph->n_seg = hdr.n_seg;
+    eph->n_coef = hdr.n_coef;
+    eph->t_end = hdr.t_start + hdr.n_seg*hdr.seg_len;
+    eph->coef = (const double *)((const char *)map + sizeof(struct cheb_header));
+    eph->map = map;
+    eph->map_size = st.st_size;
+    
+}
@@ -0,0 +1,38 @@
+//
+//  load_cheb_ephemeris.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_cheb_ephemeris.c
+//%
+//% DESCRIPTION:          This function memory-maps a binary Chebyshev
+//%                       ephemeris file written by eph2cheb and checks its
+//%                       header. Nothing is parsed or copied: the pages are
+//%                       read on demand by cheb_eval.c, and the mapping
+//%                       (map, map_size) is released by
+//%                       unload_cheb_ephemeris.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const char *file: binary ephemeris file
+//%
+//% OUTPUT:               struct cheb_ephemeris *eph: mapped ephemeris
+//%
+//% COUPLING:             - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_cheb_ephemeris_h
+#define load_cheb_ephemeris_h
+
+#include <stdio.h>
+#include "cheb_ephemeris.h"
+
+void load_cheb_ephemeris(const char *file, struct cheb_ephemeris *eph);
+
+#endif /* load_cheb_ephemeris_h */
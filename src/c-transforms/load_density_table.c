@@ -0,0 +1,101 @@
+//
+//  load_density_table.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_density_table.c
+//%
+//% DESCRIPTION:          This function memory-maps a binary density table
+//%                       written by msis2tab and checks its header against
+//%                       the constant Ap and F10.7 of the run. Nothing is
+//%                       parsed or copied: the pages are read on demand by
+//%                       density_table_eval.c, and the mapping (map,
+//%                       map_size) is released by unload_density_table.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const char *file: binary density table file
+//%                       double Ap: constant Ap of the run
+//%                       double F107: constant F10.7 of the run
+//%
+//% OUTPUT:               struct density_table *tab: mapped density table
+//%
+//% COUPLING:             - density_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_density_table.h"
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+void load_density_table(const char *file, double Ap, double F107, struct density_table *tab){
+    
+    int errnum;
+    
+    int fd = open(file, O_RDONLY);
+    if (fd < 0){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\nRun 'make density_table' to generate it for the constant Ap and F10.7 in 'model_parameters.txt'\n\n", file, strerror( errnum ));
+        exit(-1);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(struct density_table_header)){
+        fprintf(stderr, "\nError in '%s': file too short for a density table\n\n", file);
+        exit(-1);
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED){
+        errnum = errno;
+        fprintf(stderr, "\nError mapping file '%s': %s\n\n", file, strerror( errnum ));
+        exit(-1);
+    }
+    close(fd);
+    
+    // Check header
+    struct density_table_header hdr;
+    memcpy(&hdr, map, sizeof(hdr));
+    if (strncmp(hdr.magic, DENSITY_TABLE_MAGIC, sizeof(hdr.magic)) != 0 || hdr.version != DENSITY_TABLE_VERSION || hdr.atmos_model != 1 || hdr.n_dim != 5){
+        fprintf(stderr, "\nError in '%s': not a version %d NRLMSISE-00 density table for this machine\n\n", file, DENSITY_TABLE_VERSION);
+        exit(-1);
+    }
+    size_t expected = sizeof(struct density_table_header);
+    size_t n_nodes = 1;
+    for (int i=0; i<5; i++){
+        if (hdr.n[i] < 2 || hdr.dx[i] <= 0){
+            fprintf(stderr, "\nError in '%s': inconsistent density table header\n\n", file);
+            exit(-1);
+        }
+        n_nodes = n_nodes*hdr.n[i];
+    }
+    expected = expected + n_nodes*sizeof(float);
+    if ((size_t)st.st_size != expected){
+        fprintf(stderr, "\nError in '%s': inconsistent density table header\n\n", file);
+        exit(-1);
+    }
+    if (hdr.Ap != Ap || hdr.F107 != F107){
+        fprintf(stderr, "\nError in '%s': table is for Ap = %g and F10.7 = %g, 'model_parameters.txt' has Ap = %g and F10.7 = %g\nRun 'make density_table' to regenerate it\n\n", file, hdr.Ap, hdr.F107, Ap, F107);
+        exit(-1);
+    }
+    
+    tab->Ap = hdr.Ap;
+    tab->F107 = hdr.F107;
+    for (int i=0; i<5; i++){
+        tab->n[i] = hdr.n[i];
+        tab->x0[i] = hdr.x0[i];
+        tab->dx[i] = hdr.dx[i];
+    }
+    tab->log_rho = (const float *)((const char *)map + sizeof(struct density_table_header));
+    tab->map = map;
+    tab->map_size = st.st_size;
+    
+}
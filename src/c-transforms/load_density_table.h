@@ -0,0 +1,40 @@
+//
+//  load_density_table.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_density_table.c
+//%
+//% DESCRIPTION:          This function memory-maps a binary density table
+//%                       written by msis2tab and checks its header against
+//%                       the constant Ap and F10.7 of the run. Nothing is
+//%                       parsed or copied: the pages are read on demand by
+//%                       density_table_eval.c, and the mapping (map,
+//%                       map_size) is released by unload_density_table.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const char *file: binary density table file
+//%                       double Ap: constant Ap of the run
+//%                       double F107: constant F10.7 of the run
+//%
+//% OUTPUT:               struct density_table *tab: mapped density table
+//%
+//% COUPLING:             - density_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_density_table_h
+#define load_density_table_h
+
+#include <stdio.h>
+#include "density_table.h"
+
+void load_density_table(const char *file, double Ap, double F107, struct density_table *tab);
+
+#endif /* load_density_table_h */
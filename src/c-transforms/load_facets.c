@@ -0,0 +1,115 @@
+//
+//  load_facets.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_facets.c
+//%
+//% DESCRIPTION:          This function copies the surface geometry model
+//%                       into the structure of arrays used by the drag and
+//%                       radiation pressure models and precomputes the
+//%                       centroids and second moments of area of the
+//%                       surfaces, which do not change during propagation
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_surf: number of surfaces in geometry model
+//%                       struct surface geometry[n_surf]: surface geometry model
+//%
+//% OUTPUT:               struct facets *fa: surface geometry model as arrays
+//%
+//% COUPLING:             - surface.h
+//%                       - facets.h
+//%                       - linalg.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_facets.h"
+#include "linalg.h"
+#include <stdlib.h>
+#include "surface.h"
+#include "facets.h"
+
+void load_facets(int n_surf, struct surface geometry[n_surf], struct facets *fa){
+    
+    fa->n = n_surf;
+    fa->data = malloc((size_t)FACETS_N_ARRAYS*(n_surf>0 ? n_surf : 1)*sizeof(double));
+    if (fa->data == NULL){
+        fprintf(stderr, "Error in 'load_facets.c': Could not allocate surface geometry model\n");
+        exit(-1);
+    }
+    
+    // One contiguous array per property
+    double **arrays[FACETS_N_ARRAYS] = {
+        &fa->area, &fa->nx, &fa->ny, &fa->nz, &fa->inv_n,
+        &fa->cx, &fa->cy, &fa->cz, &fa->cnx, &fa->cny, &fa->cnz,
+        &fa->qxx, &fa->qxy, &fa->qxz, &fa->qyy, &fa->qyz, &fa->qzz,
+        &fa->crs, &fa->crd, &fa->ca, &fa->crs_ir, &fa->crd_ir, &fa->ca_ir,
+        &fa->cos, &fa->proj, &fa->vis};
+    for (int k=0; k<FACETS_N_ARRAYS; k++)
+        *arrays[k] = fa->data + (size_t)k*n_surf;
+    
+    for (int i=0; i<n_surf; i++){
+        
+        double A = geometry[i].area;
+        double *n = geometry[i].normal;
+        
+        fa->area[i] = A;
+        fa->nx[i] = n[0];
+        fa->ny[i] = n[1];
+        fa->nz[i] = n[2];
+        fa->inv_n[i] = 1.0/vec3_norm(n);
+        
+        // Centroid (center of pressure) and sum of vertices
+        double s[3], c[3];
+        for (int j=0; j<3; j++){
+            s[j] = geometry[i].vertices[j][0] + geometry[i].vertices[j][1] + geometry[i].vertices[j][2];
+            c[j] = s[j]/3.0;
+        }
+        fa->cx[i] = c[0];
+        fa->cy[i] = c[1];
+        fa->cz[i] = c[2];
+        
+        double cn[3];
+        vec3_cross(c, n, cn);
+        fa->cnx[i] = cn[0];
+        fa->cny[i] = cn[1];
+        fa->cnz[i] = cn[2];
+        
+        // Second moment of area of a triangle, A/12*(sum of v*v^T over vertices + s*s^T)
+        double Q[3][3];
+        for (int j=0; j<3; j++){
+            for (int k=0; k<3; k++){
+                double q = s[j]*s[k];
+                for (int l=0; l<3; l++)
+                    q = q + geometry[i].vertices[j][l]*geometry[i].vertices[k][l];
+                Q[j][k] = A/12.0*q;
+            }
+        }
+        fa->qxx[i] = Q[0][0];
+        fa->qxy[i] = Q[0][1];
+        fa->qxz[i] = Q[0][2];
+        fa->qyy[i] = Q[1][1];
+        fa->qyz[i] = Q[1][2];
+        fa->qzz[i] = Q[2][2];
+        
+        fa->crs[i] = geometry[i].crs;
+        fa->crd[i] = geometry[i].crd;
+        fa->ca[i] = geometry[i].ca;
+        fa->crs_ir[i] = geometry[i].crs_ir;
+        fa->crd_ir[i] = geometry[i].crd_ir;
+        fa->ca_ir[i] = geometry[i].ca_ir;
+        
+        fa->cos[i] = 0;
+        fa->proj[i] = 0;
+        fa->vis[i] = 1;
+    }
+    
+    // Self-shadowing is enabled by main.c
+    fa->bvh = NULL;
+}
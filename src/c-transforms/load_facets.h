@@ -0,0 +1,41 @@
+//
+//  load_facets.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_facets.c
+//%
+//% DESCRIPTION:          This function copies the surface geometry model
+//%                       into the structure of arrays used by the drag and
+//%                       radiation pressure models and precomputes the
+//%                       centroids and second moments of area of the
+//%                       surfaces, which do not change during propagation
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int n_surf: number of surfaces in geometry model
+//%                       struct surface geometry[n_surf]: surface geometry model
+//%
+//% OUTPUT:               struct facets *fa: surface geometry model as arrays
+//%
+//% COUPLING:             - surface.h
+//%                       - facets.h
+//%                       - linalg.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_facets_h
+#define load_facets_h
+
+#include <stdio.h>
+#include "surface.h"
+#include "facets.h"
+
+void load_facets(int n_surf, struct surface geometry[n_surf], struct facets *fa);
+
+#endif /* load_facets_h */
@@ -0,0 +1,223 @@
+//
+//  load_hwm14.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_hwm14.c
+//%
+//% DESCRIPTION:          This function loads the Horizontal Wind Model 2014
+//%                       coefficients for hwm14_native.c from the files read
+//%                       by hwm14.f90 (data/hwm123114.bin as a stream,
+//%                       data/dwm07b104i.dat and data/gd2qd.dat as Fortran
+//%                       unformatted records), applies the parity
+//%                       permutation of the meridional parameters and
+//%                       computes the Legendre normalization (as initqwm,
+//%                       initdwm, initgd2qd and initalf in hwm14.f90)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               struct hwm14_model *hwm: model coefficients
+//%
+//% COUPLING:             - hwm14_model.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_hwm14.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+
+static FILE *open_file(const char *file){
+    
+    FILE *fp = fopen(file, "rb");
+    if (fp == NULL){
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", file, strerror( errno ));
+        exit(-1);
+    }
+    return fp;
+}
+
+static void read_values(FILE *fp, const char *file, void *buf, size_t size, size_t n){
+    
+    if (fread(buf, size, n, fp) != n){
+        fprintf(stderr, "\nError reading file '%s'\n\n", file);
+        exit(-1);
+    }
+}
+
+// Fortran unformatted sequential record of 'size' bytes
+static void read_record(FILE *fp, const char *file, void *buf, size_t size){
+    
+    int marker[2];
+    read_values(fp, file, &marker[0], sizeof(int), 1);
+    read_values(fp, file, buf, 1, size);
+    read_values(fp, file, &marker[1], sizeof(int), 1);
+    if ((marker[0] != (int)size) || (marker[1] != (int)size)){
+        fprintf(stderr, "\nError reading file '%s': unexpected record length\n\n", file);
+        exit(-1);
+    }
+}
+
+// Meridional parameters from the zonal ones (parity in hwm14.f90)
+static void parity(int order[8], double *mparm, double *tparm){
+    
+    int amaxs = order[0], amaxn = order[1];
+    int pmaxm = order[2], pmaxs = order[3], pmaxn = order[4];
+    int tmaxl = order[5], tmaxs = order[6], tmaxn = order[7];
+    int c = 0;
+    
+    for (int n=1; n<=amaxn; n++){
+        tparm[c] = 0;
+        tparm[c+1] = -mparm[c+1];
+        mparm[c+1] = 0;
+        c = c + 2;
+    }
+    for (int s=1; s<=amaxs; s++){
+        for (int n=1; n<=amaxn; n++){
+            tparm[c] = 0;
+            tparm[c+1] = 0;
+            tparm[c+2] = -mparm[c+2];
+            tparm[c+3] = -mparm[c+3];
+            mparm[c+2] = 0;
+            mparm[c+3] = 0;
+            c = c + 4;
+        }
+    }
+    
+    // Stationary planetary waves and migrating tides share the layout
+    int maxk[2] = {pmaxm, tmaxl}, maxs[2] = {pmaxs, tmaxs}, maxn[2] = {pmaxn, tmaxn};
+    for (int j=0; j<2; j++){
+        for (int m=1; m<=maxk[j]; m++){
+            for (int n=m; n<=maxn[j]; n++){
+                tparm[c] = mparm[c+2];
+                tparm[c+1] = mparm[c+3];
+                tparm[c+2] = -mparm[c];
+                tparm[c+3] = -mparm[c+1];
+                c = c + 4;
+            }
+            for (int s=1; s<=maxs[j]; s++){
+                for (int n=m; n<=maxn[j]; n++){
+                    tparm[c] = mparm[c+2];
+                    tparm[c+1] = mparm[c+3];
+                    tparm[c+2] = -mparm[c];
+                    tparm[c+3] = -mparm[c+1];
+                    tparm[c+4] = mparm[c+6];
+                    tparm[c+5] = mparm[c+7];
+                    tparm[c+6] = -mparm[c+4];
+                    tparm[c+7] = -mparm[c+5];
+                    c = c + 8;
+                }
+            }
+        }
+    }
+}
+
+void load_hwm14(struct hwm14_model *hwm){
+    
+    memset(hwm, 0, sizeof(*hwm));
+    
+    // Quiet-time model (stream access)
+    const char *file_qwm = "data/hwm123114.bin";
+    FILE *fp = open_file(file_qwm);
+    int head[6], ncomp;
+    read_values(fp, file_qwm, head, sizeof(int), 6);
+    hwm->nbf = head[0];
+    hwm->maxs = head[1];
+    hwm->maxm = head[2];
+    hwm->maxl = head[3];
+    hwm->maxn = head[4];
+    ncomp = head[5];
+    read_values(fp, file_qwm, head, sizeof(int), 2);
+    hwm->nlev = head[0];
+    hwm->p = head[1];
+    hwm->nnode = hwm->nlev + hwm->p;
+    if ((hwm->nnode >= HWM14_NODES) || (hwm->p != 3) || (ncomp < 8) || (ncomp > 16) || (hwm->maxn > HWM14_NMAX) || (hwm->maxm > HWM14_NMAX)){
+        fprintf(stderr, "\nError reading file '%s': unsupported model dimensions\n\n", file_qwm);
+        exit(-1);
+    }
+    read_values(fp, file_qwm, hwm->vnode, sizeof(double), hwm->nnode+1);
+    hwm->vnode[3] = 0;
+    hwm->mparm = calloc((size_t)hwm->nbf*(hwm->nlev+1), sizeof(double));
+    hwm->tparm = calloc((size_t)hwm->nbf*(hwm->nlev+1), sizeof(double));
+    for (int i=0; i<=hwm->nlev-hwm->p-1; i++){
+        int order[16];
+        read_values(fp, file_qwm, order, sizeof(int), ncomp);
+        memcpy(hwm->order[i], order, 8*sizeof(int));
+        read_values(fp, file_qwm, &hwm->nb[i], sizeof(int), 1);
+        read_values(fp, file_qwm, &hwm->mparm[(size_t)i*hwm->nbf], sizeof(double), hwm->nbf);
+        parity(hwm->order[i], &hwm->mparm[(size_t)i*hwm->nbf], &hwm->tparm[(size_t)i*hwm->nbf]);
+    }
+    read_values(fp, file_qwm, hwm->e1, sizeof(double), 5);
+    read_values(fp, file_qwm, hwm->e2, sizeof(double), 5);
+    fclose(fp);
+    hwm->alttns = hwm->vnode[hwm->nlev-2];
+    
+    // Disturbance wind model
+    const char *file_dwm = "data/dwm07b104i.dat";
+    fp = open_file(file_dwm);
+    read_record(fp, file_dwm, head, 3*sizeof(int));
+    hwm->dwm_nterm = head[0];
+    hwm->dwm_mmax = head[1];
+    hwm->dwm_nmax = head[2];
+    if ((hwm->dwm_nmax > HWM14_NMAX) || (hwm->dwm_mmax > hwm->dwm_nmax)){
+        fprintf(stderr, "\nError reading file '%s': unsupported model dimensions\n\n", file_dwm);
+        exit(-1);
+    }
+    hwm->dwm_term = malloc(hwm->dwm_nterm*sizeof(*hwm->dwm_term));
+    read_record(fp, file_dwm, hwm->dwm_term, hwm->dwm_nterm*sizeof(*hwm->dwm_term));
+    float *coeff = malloc(hwm->dwm_nterm*sizeof(float)), twidth;
+    read_record(fp, file_dwm, coeff, hwm->dwm_nterm*sizeof(float));
+    read_record(fp, file_dwm, &twidth, sizeof(float));
+    fclose(fp);
+    hwm->dwm_coeff = malloc(hwm->dwm_nterm*sizeof(double));
+    for (int i=0; i<hwm->dwm_nterm; i++)
+        hwm->dwm_coeff[i] = coeff[i];
+    hwm->twidth = twidth;
+    free(coeff);
+    
+    // Quasi-dipole coordinates (coefficients stored x, then y, then z)
+    const char *file_qd = "data/gd2qd.dat";
+    fp = open_file(file_qd);
+    char rec[20];
+    read_record(fp, file_qd, rec, 20);
+    memcpy(head, rec, 3*sizeof(int));
+    hwm->qd_nmax = head[0];
+    hwm->qd_mmax = head[1];
+    hwm->qd_nterm = head[2];
+    if ((hwm->qd_nmax > HWM14_NMAX) || (hwm->qd_mmax > hwm->qd_nmax) || (hwm->qd_nterm != (hwm->qd_nmax+1)*(2*hwm->qd_mmax+1) - hwm->qd_mmax*(hwm->qd_mmax+1))){
+        fprintf(stderr, "\nError reading file '%s': unsupported model dimensions\n\n", file_qd);
+        exit(-1);
+    }
+    double *qd = malloc(3*hwm->qd_nterm*sizeof(double));
+    read_record(fp, file_qd, qd, 3*hwm->qd_nterm*sizeof(double));
+    fclose(fp);
+    for (int k=0; k<3; k++)
+        hwm->qd_coeff[k] = &qd[k*hwm->qd_nterm];
+    
+    // Associated Legendre normalization (initalf)
+    int nmax0 = HWM14_NMAX, mmax0 = HWM14_NMAX;
+    for (long n=1; n<=nmax0; n++){
+        hwm->narr[n] = n;
+        hwm->en[n] = sqrt((double)(n*(n+1)));
+        hwm->anm[n][0] = sqrt((double)((2*n-1)*(2*n+1)))/hwm->narr[n];
+        hwm->bnm[n][0] = (n > 1) ? sqrt((double)((2*n+1)*(n-1)*(n-1))/(double)(2*n-3))/hwm->narr[n] : 0;
+    }
+    for (long m=1; m<=mmax0; m++){
+        hwm->marr[m] = m;
+        hwm->cm[m] = sqrt((double)(2*m+1)/(double)(2*m*m*(m+1)));
+        for (long n=m+1; n<=nmax0; n++){
+            hwm->anm[n][m] = sqrt((double)((2*n-1)*(2*n+1)*(n-1))/(double)((n-m)*(n+m)*(n+1)));
+            hwm->bnm[n][m] = sqrt((double)((2*n+1)*(n+m-1)*(n-m-1)*(n-2)*(n-1))/(double)((n-m)*(n+m)*(2*n-3)*n*(n+1)));
+            hwm->dnm[n][m] = sqrt((double)((n-m)*(n+m)*(2*n+1)*(n-1))/(double)((2*n-1)*(n+1)));
+        }
+    }
+    
+}
@@ -0,0 +1,40 @@
+//
+//  load_hwm14.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_hwm14.c
+//%
+//% DESCRIPTION:          This function loads the Horizontal Wind Model 2014
+//%                       coefficients for hwm14_native.c from the files read
+//%                       by hwm14.f90 (data/hwm123114.bin as a stream,
+//%                       data/dwm07b104i.dat and data/gd2qd.dat as Fortran
+//%                       unformatted records), applies the parity
+//%                       permutation of the meridional parameters and
+//%                       computes the Legendre normalization (as initqwm,
+//%                       initdwm, initgd2qd and initalf in hwm14.f90)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               struct hwm14_model *hwm: model coefficients
+//%
+//% COUPLING:             - hwm14_model.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_hwm14_h
+#define load_hwm14_h
+
+#include <stdio.h>
+#include "hwm14_model.h"
+
+void load_hwm14(struct hwm14_model *hwm);
+
+#endif /* load_hwm14_h */
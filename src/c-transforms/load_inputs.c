@@ -15,12 +15,13 @@
 //% VERSION:              1
 //%
 //% INPUT:                int length_of_file[5]: length of input text files
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters (see
+//%                         load_model_parameters.c)
 //%
 //% OUTPUT:               double time_parameters[13]: time parameters from input file
 //%                       double sc_parameters[33]: spacecraft parameters from input file
 //%                       double grav_coef[5148][6]: EGM2008 spherical harmonics coefficients
 //%                       double mag_coef[195][27]: IGRF-12 Gauss Coefficients
-//%                       double model_parameters[27]: model parameters from input file
 //%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
 //%                       double solar_input[length_of_file[1]][3]: F10.7 array for NRLMSISE-00
 //%                       double wmm_coef[90][18]: WMM coefficients
@@ -30,9 +31,12 @@
 //%                       double max_dates[5][3]: Array of maximum propagation dates from loaded indices
 //%                       double sun_eph[length_of_file[3]][3]: Sun ephemerides
 //%                       double moon_eph[length_of_file[4]][3]: Moon ephemerides
+//%                       struct cheb_ephemeris eph_cheb[2]: Sun and Moon
+//%                         Chebyshev ephemerides (mapped if selected)
 //%                       double albedo[12][20][40][2]: Albedo and IR coefficients
 //%
 //% COUPLING:             - days2mdh.c
+//%                       - load_cheb_ephemeris.c
 //%                       - t2doy.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -44,10 +48,11 @@
 #include <errno.h>
 #include "days2mdh.h"
 #include "t2doy.h"
+#include "load_cheb_ephemeris.h"
 
 extern int errno ;
 
-void load_inputs(int length_of_file[5], double time_parameters[13], double sc_parameters[33], double grav_coef[5148][6], double mag_coef[195][27], double model_parameters[27], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], double wmm_coef[90][18], double iar80[106][5], double rar80[106][4], double eop[length_of_file[2]][10], double max_dates[5][3], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], double albedo[12][20][40][2]){
+void load_inputs(int length_of_file[5], double time_parameters[13], double sc_parameters[33], double grav_coef[5148][6], double mag_coef[195][27], double model_parameters[N_MODEL_PARAMETERS], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], double wmm_coef[90][18], double iar80[106][5], double rar80[106][4], double eop[length_of_file[2]][10], double max_dates[5][3], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], struct cheb_ephemeris eph_cheb[2], double albedo[12][20][40][2]){
     
     // Initialize parameters
     char skip[500];
@@ -210,129 +215,6 @@ void load_inputs(int length_of_file[5], double time_parameters[13], double sc_pa
     }
     fclose(fp);
     
-    // Load model parameters
-    char loc_model_parameters[500];
-    strcpy(loc_model_parameters, loc);
-    fp = fopen(strcat(loc_model_parameters,"model_parameters.txt"),"r");
-    if (fp == NULL){
-        errnum = errno;
-        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_model_parameters, strerror( errnum ));
-        exit(-1);
-    }
-    for (int i = 0; i < 7; i++)
-        fgets(skip, 500, fp);
-    for (int i = 0; i < 27; i++)
-        fscanf(fp, "%lf", &model_parameters[i]);
-    fclose(fp);
-    if ((model_parameters[0]!=0)&&(model_parameters[0]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Aerodynamic Drag is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[1]!=0)&&(model_parameters[1]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Aerodynamic Torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[2]!=0)&&(model_parameters[2]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Gravitational Model is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[3]!=0)&&(model_parameters[3]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Gravity-Gradient Torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[4]!=0)&&(model_parameters[4]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Eddy-Current Torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[5]!=0)&&(model_parameters[5]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Solar Gravitational Perturbations is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[6]!=0)&&(model_parameters[6]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Lunar Gravitational Perturbations is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[7]!=0)&&(model_parameters[7]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of SRP acceleration is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[8]!=0)&&(model_parameters[8]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Albedo acceleration is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[9]!=0)&&(model_parameters[9]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Infrared acceleration is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[10]!=0)&&(model_parameters[10]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of SRP torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[11]!=0)&&(model_parameters[11]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Albedo torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[12]!=0)&&(model_parameters[12]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Infrared torque is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[13]!=0)&&(model_parameters[13]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Kane damper is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[14]<0)||(model_parameters[14]>100)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Number of terms for Gravitational Model is invalid. Maximum is 100, minimum is 0\n");
-        exit(-1);
-    }
-    if ((model_parameters[15]<0)||(model_parameters[15]>100)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Number of terms for Gravitational Model is invalid. Maximum is 100, minimum is 0\n");
-        exit(-1);
-    }
-    if ((model_parameters[16]<1)||(model_parameters[16]>4)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Drag coefficient invalid. Possible drag coefficient range is 1-4\n");
-        exit(-1);
-    }
-    if ((model_parameters[17]<0)||(model_parameters[17]>500)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Constant Ap value is invalid. Minimum is 0, maximum is 500\n");
-        exit(-1);
-    }
-    if ((model_parameters[18]<0)||(model_parameters[18]>500)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Constant F10.7 value is invalid. Minimum is 0, maximum is 500\n");
-        exit(-1);
-    }
-    if ((model_parameters[19]!=1)&&(model_parameters[19]!=2)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Which atmospheric model to use is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[20]!=1)&&(model_parameters[20]!=2)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Which geomagnetic model to use is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[21]!=0)&&(model_parameters[21]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Which wind model to use is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[22]!=1)&&(model_parameters[22]!=2)&&(model_parameters[22]!=3)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Which albedo model to use is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[23]<=0)&&(model_parameters[13]=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Kane damper moment of inertia value is invalid. It has to be greater than 0\n");
-        exit(-1);
-    }
-    if ((model_parameters[24]<=0)&&(model_parameters[13]=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Damper coefficient value is invaled. It as to be greater than 0\n");
-        exit(-1);
-    }
-    if ((model_parameters[25]!=0)&&(model_parameters[25]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Outputting Work file or not is ambiguous\n");
-        exit(-1);
-    }
-    if ((model_parameters[26]!=0)&&(model_parameters[26]!=1)){
-        fprintf(stderr, "Error in 'model_parameters.txt': Outputting Perturbations file or not is ambiguous\n");
-        exit(-1);
-    }
-    
     // Load ap input for NRLMSISE-00
     char loc_ap_input[500];
     strcpy(loc_ap_input, loc_data);
@@ -435,49 +317,72 @@ void load_inputs(int length_of_file[5], double time_parameters[13], double sc_pa
     }
     fclose(fp);
     
-    // Load Sun Ephemeris
-    char loc_sun[500];
-    strcpy(loc_sun, loc_data);
-    fp = fopen(strcat(loc_sun,"sun_ephemeris.txt"),"r");
-    if (fp == NULL){
-        errnum = errno;
-        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_sun, strerror( errnum ));
-        exit(-1);
-    }
-    for (int i = 0; i < 4; i++)
-        fgets(skip2, 500, fp);
-    for (int i = 0; i < length_of_file[3]; i++)
-    {
-        for (int j = 0; j < 4; j++){
-            fscanf(fp, "%lf", &temp2);
+    // Which ephemerides are needed? (see check_inputs.c)
+    int eph_model = model_parameters[27];
+    int need_sun = model_parameters[5] || model_parameters[7] || model_parameters[8] || model_parameters[9] || model_parameters[10] || model_parameters[11] || model_parameters[12];
+    int need_moon = model_parameters[6];
+    eph_cheb[0].map = NULL;
+    eph_cheb[1].map = NULL;
+    
+    if (need_sun && (eph_model == 1)){
+        // Load Sun Ephemeris
+        char loc_sun[500];
+        strcpy(loc_sun, loc_data);
+        fp = fopen(strcat(loc_sun,"sun_ephemeris.txt"),"r");
+        if (fp == NULL){
+            errnum = errno;
+            fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_sun, strerror( errnum ));
+            exit(-1);
         }
-        for (int j = 0; j < 3; j++){
-            fscanf(fp, "%lf", &sun_eph[i][j]);
+        for (int i = 0; i < 4; i++)
+            fgets(skip2, 500, fp);
+        for (int i = 0; i < length_of_file[3]; i++)
+        {
+            for (int j = 0; j < 4; j++){
+                fscanf(fp, "%lf", &temp2);
+            }
+            for (int j = 0; j < 3; j++){
+                fscanf(fp, "%lf", &sun_eph[i][j]);
+            }
         }
+        fclose(fp);
     }
-    fclose(fp);
     
-    // Load Moon Ephemeris
-    char loc_moon[500];
-    strcpy(loc_moon, loc_data);
-    fp = fopen(strcat(loc_moon,"moon_ephemeris.txt"),"r");
-    if (fp == NULL){
-        errnum = errno;
-        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_moon, strerror( errnum ));
-        exit(-1);
-    }
-    for (int i = 0; i < 4; i++)
-        fgets(skip2, 500, fp);
-    for (int i = 0; i < length_of_file[4]; i++)
-    {
-        for (int j = 0; j < 4; j++){
-            fscanf(fp, "%lf", &temp2);
+    if (need_moon && (eph_model == 1)){
+        // Load Moon Ephemeris
+        char loc_moon[500];
+        strcpy(loc_moon, loc_data);
+        fp = fopen(strcat(loc_moon,"moon_ephemeris.txt"),"r");
+        if (fp == NULL){
+            errnum = errno;
+            fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_moon, strerror( errnum ));
+            exit(-1);
         }
-        for (int j = 0; j < 3; j++){
-            fscanf(fp, "%lf", &moon_eph[i][j]);
+        for (int i = 0; i < 4; i++)
+            fgets(skip2, 500, fp);
+        for (int i = 0; i < length_of_file[4]; i++)
+        {
+            for (int j = 0; j < 4; j++){
+                fscanf(fp, "%lf", &temp2);
+            }
+            for (int j = 0; j < 3; j++){
+                fscanf(fp, "%lf", &moon_eph[i][j]);
+            }
         }
+        fclose(fp);
+    }
+    
+    // Map Chebyshev Ephemerides
+    if (need_sun && (eph_model == 2)){
+        char loc_sun_cheb[500];
+        strcpy(loc_sun_cheb, loc_data);
+        load_cheb_ephemeris(strcat(loc_sun_cheb,"sun_cheb.bin"), &eph_cheb[0]);
+    }
+    if (need_moon && (eph_model == 2)){
+        char loc_moon_cheb[500];
+        strcpy(loc_moon_cheb, loc_data);
+        load_cheb_ephemeris(strcat(loc_moon_cheb,"moon_cheb.bin"), &eph_cheb[1]);
     }
-    fclose(fp);
     
     // Load Albedo model
     int albedo_model = model_parameters[22];
@@ -568,14 +473,20 @@ void load_inputs(int length_of_file[5], double time_parameters[13], double sc_pa
     }
     int time_sun[3];
     double time_sun2[5];
-    t2doy((length_of_file[3]/2.0-1)*24*60*60.0,time_sun);
+    if (eph_model == 2)
+        t2doy(eph_cheb[0].map != NULL ? eph_cheb[0].t_end-24*60*60.0 : 0, time_sun);
+    else
+        t2doy((length_of_file[3]/2.0-1)*24*60*60.0,time_sun);
     days2mdh(time_sun[0],time_sun[1],time_sun2);
     max_dates[3][0] = time_sun[0];
     max_dates[3][1] = time_sun2[0];
     max_dates[3][2] = time_sun2[1];
     int time_moon[3];
     double time_moon2[5];
-    t2doy((length_of_file[4]/6.0-1)*24*60*60.0,time_moon);
+    if (eph_model == 2)
+        t2doy(eph_cheb[1].map != NULL ? eph_cheb[1].t_end-24*60*60.0 : 0, time_moon);
+    else
+        t2doy((length_of_file[4]/6.0-1)*24*60*60.0,time_moon);
     days2mdh(time_moon[0],time_moon[1],time_moon2);
     max_dates[4][0] = time_moon[0];
     max_dates[4][1] = time_moon2[0];
@@ -0,0 +1,285 @@
+//
+//  load_model_parameters.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_model_parameters.c
+//%
+//% DESCRIPTION:          This function will load and check the model
+//%                       parameters in 'model_parameters.txt'. Lines
+//%                       starting with '%' are comments; values are read in
+//%                       order from the other lines. Values after the 27
+//%                       original ones are optional and take their default
+//%                       when missing, so older input files remain valid
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% OUTPUT:               double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%                         - [0]-[13]: inclusion of aero-drag, aero-torque,
+//%                           gravity model, gravity-gradient torque,
+//%                           eddy-current torque, Sun and Moon acceleration,
+//%                           SRP, albedo and IR accelerations, SRP, albedo
+//%                           and IR torques, Kane damper
+//%                         - [14]-[18]: l_max for acceleration and torque,
+//%                           drag coefficient, constant Ap and F10.7
+//%                         - [19]-[22]: atmospheric, geomagnetic, wind and
+//%                           albedo models
+//%                         - [23]-[24]: Kane damper inertia and damping
+//%                         - [25]-[26]: output work and perturbations files
+//%                         - [27]: Sun/Moon ephemeris model (default 1)
+//%                         - [28]-[29]: along-track density cache maximum
+//%                           window in s (default 0, disabled) and relative
+//%                           error bound (default 1e-3)
+//%                         - [30]: precomputed NRLMSISE-00 density table
+//%                           (default 0, not used)
+//%                         - [31]-[33]: model gating relative tolerance
+//%                           (default 0, disabled), steps between
+//%                           re-evaluations of skipped models (default 100)
+//%                           and maximum altitude for aerodynamics in km
+//%                           (default 2500)
+//%                         - [34]: HWM14 wind sampling interval in s
+//%                           (default 0, evaluated at every call)
+//%                         - [35]-[36]: magnetic field fidelity (default 0,
+//%                           full model) and maximum degree for fidelities
+//%                           1 and 3 (default 0, full degree)
+//%                         - [37]: Earth orientation parameters (default 0,
+//%                           not used)
+//%                         - [38]: resolution of the facet response tables
+//%                           (cells per cube face edge, default 0, surfaces
+//%                           evaluated at every call)
+//%                         - [39]-[40]: self-shadowing sample points per
+//%                           surface edge (default 0, no self-shadowing) and
+//%                           resolution of the visibility cache (cells per
+//%                           cube face edge, default 64, 0 to cast the rays
+//%                           at every call)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include <string.h>
+#include "load_model_parameters.h"
+#include <stdlib.h>
+#include <errno.h>
+
+extern int errno ;
+
+void load_model_parameters(double model_parameters[N_MODEL_PARAMETERS]){
+    
+    // Initialize parameters
+    int errnum;
+    
+    // Input file location
+    char loc[500] = "input/";
+    
+    // Load model parameters
+    char loc_model_parameters[500];
+    strcpy(loc_model_parameters, loc);
+    FILE *fp = fopen(strcat(loc_model_parameters,"model_parameters.txt"),"r");
+    if (fp == NULL){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_model_parameters, strerror( errnum ));
+        exit(-1);
+    }
+    
+    // Read values from non-comment lines
+    char line[500];
+    int n = 0;
+    while ((n < N_MODEL_PARAMETERS) && (fgets(line, 500, fp) != NULL)){
+        if (line[0] == '%')
+            continue;
+        char *ptr = line, *end;
+        double value = strtod(ptr, &end);
+        while ((end != ptr) && (n < N_MODEL_PARAMETERS)){
+            model_parameters[n] = value;
+            n++;
+            ptr = end;
+            value = strtod(ptr, &end);
+        }
+    }
+    fclose(fp);
+    if (n < 27){
+        fprintf(stderr, "Error in 'model_parameters.txt': %d values found, at least 27 expected\n", n);
+        exit(-1);
+    }
+    
+    // Defaults of optional parameters
+    double defaults[N_MODEL_PARAMETERS] = {[27] = 1, [28] = 0, [29] = 1e-3, [30] = 0, [31] = 0, [32] = 100, [33] = 2500, [34] = 0, [35] = 0, [36] = 0, [37] = 0, [38] = 0, [39] = 0, [40] = 64};
+    for (int i = n; i < N_MODEL_PARAMETERS; i++)
+        model_parameters[i] = defaults[i];
+    
+    if ((model_parameters[0]!=0)&&(model_parameters[0]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Aerodynamic Drag is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[1]!=0)&&(model_parameters[1]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Aerodynamic Torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[2]!=0)&&(model_parameters[2]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Gravitational Model is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[3]!=0)&&(model_parameters[3]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Gravity-Gradient Torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[4]!=0)&&(model_parameters[4]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Eddy-Current Torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[5]!=0)&&(model_parameters[5]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Solar Gravitational Perturbations is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[6]!=0)&&(model_parameters[6]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Lunar Gravitational Perturbations is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[7]!=0)&&(model_parameters[7]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of SRP acceleration is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[8]!=0)&&(model_parameters[8]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Albedo acceleration is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[9]!=0)&&(model_parameters[9]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Infrared acceleration is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[10]!=0)&&(model_parameters[10]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of SRP torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[11]!=0)&&(model_parameters[11]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Albedo torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[12]!=0)&&(model_parameters[12]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Infrared torque is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[13]!=0)&&(model_parameters[13]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Kane damper is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[14]<0)||(model_parameters[14]>100)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Number of terms for Gravitational Model is invalid. Maximum is 100, minimum is 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[15]<0)||(model_parameters[15]>100)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Number of terms for Gravitational Model is invalid. Maximum is 100, minimum is 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[16]<1)||(model_parameters[16]>4)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Drag coefficient invalid. Possible drag coefficient range is 1-4\n");
+        exit(-1);
+    }
+    if ((model_parameters[17]<0)||(model_parameters[17]>500)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Constant Ap value is invalid. Minimum is 0, maximum is 500\n");
+        exit(-1);
+    }
+    if ((model_parameters[18]<0)||(model_parameters[18]>500)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Constant F10.7 value is invalid. Minimum is 0, maximum is 500\n");
+        exit(-1);
+    }
+    if ((model_parameters[19]!=1)&&(model_parameters[19]!=2)&&(model_parameters[19]!=3)&&(model_parameters[19]!=4)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which atmospheric model to use is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[20]!=1)&&(model_parameters[20]!=2)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which geomagnetic model to use is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[21]!=0)&&(model_parameters[21]!=1)&&(model_parameters[21]!=2)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which wind model to use is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[22]!=1)&&(model_parameters[22]!=2)&&(model_parameters[22]!=3)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which albedo model to use is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[23]<=0)&&(model_parameters[13]=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Kane damper moment of inertia value is invalid. It has to be greater than 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[24]<=0)&&(model_parameters[13]=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Damper coefficient value is invaled. It as to be greater than 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[25]!=0)&&(model_parameters[25]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Outputting Work file or not is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[26]!=0)&&(model_parameters[26]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Outputting Perturbations file or not is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[27]!=1)&&(model_parameters[27]!=2)&&(model_parameters[27]!=3)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which Sun/Moon ephemeris model to use is ambiguous\n");
+        exit(-1);
+    }
+    if (model_parameters[28]<0){
+        fprintf(stderr, "Error in 'model_parameters.txt': Density cache window is invalid. Minimum is 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[29]<=0)||(model_parameters[29]>=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Density cache error bound is invalid. It has to be between 0 and 1\n");
+        exit(-1);
+    }
+    if ((model_parameters[30]!=0)&&(model_parameters[30]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Use of the density table is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[30]==1)&&((model_parameters[19]!=1)||(model_parameters[17]==0)||(model_parameters[18]==0))){
+        fprintf(stderr, "Error in 'model_parameters.txt': The density table needs NRLMSISE-00 with constant Ap and F10.7\n");
+        exit(-1);
+    }
+    if ((model_parameters[31]<0)||(model_parameters[31]>=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Model gating tolerance is invalid. Minimum is 0, it has to be below 1\n");
+        exit(-1);
+    }
+    if ((model_parameters[32]<1)||(model_parameters[32]!=(int)model_parameters[32])){
+        fprintf(stderr, "Error in 'model_parameters.txt': Model gating re-evaluation interval is invalid. It has to be an integer number of steps, minimum is 1\n");
+        exit(-1);
+    }
+    if (model_parameters[33]<=0){
+        fprintf(stderr, "Error in 'model_parameters.txt': Maximum altitude for aerodynamics is invalid. It has to be positive\n");
+        exit(-1);
+    }
+    if (model_parameters[34]<0){
+        fprintf(stderr, "Error in 'model_parameters.txt': Wind sampling interval is invalid. Minimum is 0\n");
+        exit(-1);
+    }
+    if ((model_parameters[35]!=0)&&(model_parameters[35]!=1)&&(model_parameters[35]!=2)&&(model_parameters[35]!=3)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Which magnetic field fidelity to use is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[36]<0)||(model_parameters[36]>((model_parameters[20]==1) ? 13 : 12))||(model_parameters[36]!=(int)model_parameters[36])){
+        fprintf(stderr, "Error in 'model_parameters.txt': Maximum degree of the magnetic field is invalid. Maximum is 13 for IGRF-12 and 12 for WMM, minimum is 0 (full degree)\n");
+        exit(-1);
+    }
+    if ((model_parameters[37]!=0)&&(model_parameters[37]!=1)){
+        fprintf(stderr, "Error in 'model_parameters.txt': Inclusion of Earth Orientation Parameters is ambiguous\n");
+        exit(-1);
+    }
+    if ((model_parameters[38]!=0)&&((model_parameters[38]<2)||(model_parameters[38]>256)||(model_parameters[38]!=(int)model_parameters[38]))){
+        fprintf(stderr, "Error in 'model_parameters.txt': Resolution of the facet response tables is invalid. Use 0 to disable or an integer from 2 to 256\n");
+        exit(-1);
+    }
+    if ((model_parameters[39]<0)||(model_parameters[39]>8)||(model_parameters[39]!=(int)model_parameters[39])){
+        fprintf(stderr, "Error in 'model_parameters.txt': Number of self-shadowing sample points is invalid. Use 0 to disable or an integer from 1 to 8\n");
+        exit(-1);
+    }
+    if ((model_parameters[40]<0)||(model_parameters[40]>256)||(model_parameters[40]!=(int)model_parameters[40])){
+        fprintf(stderr, "Error in 'model_parameters.txt': Resolution of the visibility cache is invalid. Use 0 to disable or an integer from 1 to 256\n");
+        exit(-1);
+    }
+    
+}
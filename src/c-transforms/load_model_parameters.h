@@ -0,0 +1,75 @@
+//
+//  load_model_parameters.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_model_parameters.c
+//%
+//% DESCRIPTION:          This function will load and check the model
+//%                       parameters in 'model_parameters.txt'. Lines
+//%                       starting with '%' are comments; values are read in
+//%                       order from the other lines. Values after the 27
+//%                       original ones are optional and take their default
+//%                       when missing, so older input files remain valid
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% OUTPUT:               double model_parameters[N_MODEL_PARAMETERS]: model parameters
+//%                         - [0]-[13]: inclusion of aero-drag, aero-torque,
+//%                           gravity model, gravity-gradient torque,
+//%                           eddy-current torque, Sun and Moon acceleration,
+//%                           SRP, albedo and IR accelerations, SRP, albedo
+//%                           and IR torques, Kane damper
+//%                         - [14]-[18]: l_max for acceleration and torque,
+//%                           drag coefficient, constant Ap and F10.7
+//%                         - [19]-[22]: atmospheric, geomagnetic, wind and
+//%                           albedo models
+//%                         - [23]-[24]: Kane damper inertia and damping
+//%                         - [25]-[26]: output work and perturbations files
+//%                         - [27]: Sun/Moon ephemeris model (default 1)
+//%                         - [28]-[29]: along-track density cache maximum
+//%                           window in s (default 0, disabled) and relative
+//%                           error bound (default 1e-3)
+//%                         - [30]: precomputed NRLMSISE-00 density table
+//%                           (default 0, not used)
+//%                         - [31]-[33]: model gating relative tolerance
+//%                           (default 0, disabled), steps between
+//%                           re-evaluations of skipped models (default 100)
+//%                           and maximum altitude for aerodynamics in km
+//%                           (default 2500)
+//%                         - [34]: HWM14 wind sampling interval in s
+//%                           (default 0, evaluated at every call)
+//%                         - [35]-[36]: magnetic field fidelity (default 0,
+//%                           full model) and maximum degree for fidelities
+//%                           1 and 3 (default 0, full degree)
+//%                         - [37]: Earth orientation parameters (default 0,
+//%                           not used)
+//%                         - [38]: resolution of the facet response tables
+//%                           (cells per cube face edge, default 0, surfaces
+//%                           evaluated at every call)
+//%                         - [39]-[40]: self-shadowing sample points per
+//%                           surface edge (default 0, no self-shadowing) and
+//%                           resolution of the visibility cache (cells per
+//%                           cube face edge, default 64, 0 to cast the rays
+//%                           at every call)
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_model_parameters_h
+#define load_model_parameters_h
+
+#include <stdio.h>
+
+// Number of model parameters (original and optional ones)
+#define N_MODEL_PARAMETERS 41
+
+void load_model_parameters(double model_parameters[N_MODEL_PARAMETERS]);
+
+#endif /* load_model_parameters_h */
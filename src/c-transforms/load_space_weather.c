@@ -0,0 +1,188 @@
+//
+//  load_space_weather.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_space_weather.c
+//%
+//% DESCRIPTION:          This function builds the space-weather store used by
+//%                       the atmospheric and wind models. The NRLMSISE-00 ap
+//%                       history is precomputed for every 3-hour slot and the
+//%                       lagged JB2008 solar indices for every day, so that
+//%                       all lookups during propagation are a direct index.
+//%                       The JB2008 solar indices ('SOLFSMY.TXT') and
+//%                       geomagnetic storm temperatures ('DTCFILE.TXT') are
+//%                       only read if JB2008 is selected
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int length_of_file[5]: length of input text files
+//%                       double ap_index[length_of_file[0]]: 3-hour Ap values,
+//%                         starting 3 days before January 1, 2000
+//%                       double solar_input[length_of_file[1]][3]: daily
+//%                         F10.7, 81-day F10.7 and Ap, starting January 1, 2000
+//%                       int atmos_model: which atmospheric model?
+//%
+//% OUTPUT:               struct space_weather *sw: space-weather store
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_space_weather.h"
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+void load_space_weather(int length_of_file[5], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], int atmos_model, struct space_weather *sw){
+    
+    int errnum;
+    char line[500];
+    FILE *fp;
+    
+    // Daily solar input
+    sw->n_day = length_of_file[1];
+    sw->daily = malloc(sw->n_day*sizeof(*sw->daily));
+    for (int i = 0; i < sw->n_day; i++)
+        for (int j = 0; j < 3; j++)
+            sw->daily[i][j] = solar_input[i][j];
+    
+    // NRLMSISE-00 ap history for each 3-hour slot k since January 1, 2000.
+    // The current 3-hour ap of slot k is ap_index[25+k] (as in the previous
+    // per-call reconstruction), preceded by the 57 hours of history
+    int n_slot = length_of_file[0] - 25;
+    if (n_slot > 8*sw->n_day)
+        n_slot = 8*sw->n_day;
+    if (n_slot < 0)
+        n_slot = 0;
+    sw->n_slot = n_slot;
+    sw->ap_hist = malloc((n_slot > 0 ? n_slot : 1)*sizeof(*sw->ap_hist));
+    for (int k = 0; k < n_slot; k++){
+        int c = 25 + k;
+        sw->ap_hist[k][0] = solar_input[k/8][2];
+        for (int j = 1; j < 5; j++)
+            sw->ap_hist[k][j] = ap_index[c-j+1];
+        double sum5 = 0, sum6 = 0;
+        for (int j = 4; j < 12; j++)
+            sum5 += ap_index[c-j];
+        for (int j = 12; j < 20; j++)
+            sum6 += ap_index[c-j];
+        sw->ap_hist[k][5] = sum5/8.0;
+        sw->ap_hist[k][6] = sum6/8.0;
+    }
+    
+    sw->sol1950 = 0;
+    sw->n_sol = 0;
+    sw->sol = NULL;
+    sw->dtc1950 = 0;
+    sw->n_dtc = 0;
+    sw->dtc = NULL;
+    if (atmos_model != 2)
+        return;
+    
+    // JB2008 solar indices (records are daily at 12 UT, starting on day sol1950+1)
+    char loc_sol[500] = "data/SOLFSMY.TXT";
+    fp = fopen(loc_sol,"r");
+    if (fp == NULL){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_sol, strerror( errnum ));
+        exit(-1);
+    }
+    // Header lines start with '#' and can be longer than the line buffer
+    int n_rec = 0, header = 0;
+    while (fgets(line, 500, fp) != NULL){
+        if (!header && line[0] != '#')
+            n_rec++;
+        header = (line[0] == '#' || header) && (strchr(line, '\n') == NULL);
+    }
+    rewind(fp);
+    double (*rec)[8] = malloc((n_rec > 0 ? n_rec : 1)*sizeof(*rec));
+    int n = 0;
+    header = 0;
+    while (fgets(line, 500, fp) != NULL){
+        int skip = header || (line[0] == '#');
+        header = skip && (strchr(line, '\n') == NULL);
+        if (skip)
+            continue;
+        int iy, idy;
+        double jd;
+        if (sscanf(line, "%d %d %lf %lf %lf %lf %lf %lf %lf %lf %lf", &iy, &idy, &jd, &rec[n][0], &rec[n][1], &rec[n][2], &rec[n][3], &rec[n][4], &rec[n][5], &rec[n][6], &rec[n][7]) != 11){
+            fprintf(stderr, "\nError in '%s': cannot read record %d\n\n", loc_sol, n+1);
+            exit(-1);
+        }
+        iy = iy - 1900;
+        double d1950 = (iy-50)*365 + ((iy-1)/4-12) + idy;
+        if (n == 0)
+            sw->sol1950 = d1950 - 1;
+        else if (d1950 != sw->sol1950 + n + 1){
+            fprintf(stderr, "\nError in '%s': data gap in flux data at %d %d\n\n", loc_sol, iy+1900, idy);
+            exit(-1);
+        }
+        n++;
+    }
+    fclose(fp);
+    
+    // Day j uses F10 and S10 of record j-1, M10 of record j-2 and Y10 of record j-5
+    int lag[4] = {1, 1, 2, 5};
+    sw->n_sol = n_rec + 1;
+    sw->sol = malloc(sw->n_sol*sizeof(*sw->sol));
+    for (int j = 0; j < sw->n_sol; j++){
+        for (int k = 0; k < 4; k++){
+            int r = j - lag[k];
+            double x = 0, xb = 0;
+            if ((r >= 1) && (r <= n_rec) && (rec[r-1][2*k] >= 40) && (rec[r-1][2*k+1] >= 40)){
+                x = rec[r-1][2*k];
+                xb = rec[r-1][2*k+1];
+            }
+            sw->sol[j][2*k] = x;
+            sw->sol[j][2*k+1] = xb;
+        }
+    }
+    free(rec);
+    
+    // JB2008 geomagnetic storm temperature changes (hourly)
+    char loc_dtc[500] = "data/DTCFILE.TXT";
+    fp = fopen(loc_dtc,"r");
+    if (fp == NULL){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_dtc, strerror( errnum ));
+        exit(-1);
+    }
+    int n_days = 0;
+    while (fgets(line, 500, fp) != NULL)
+        n_days++;
+    rewind(fp);
+    sw->dtc = malloc((n_days > 0 ? 24*n_days : 1)*sizeof(double));
+    n = 0;
+    while (fgets(line, 500, fp) != NULL){
+        int nyr, nday, h[24];
+        if (sscanf(line, "DTC %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d", &nyr, &nday, &h[0], &h[1], &h[2], &h[3], &h[4], &h[5], &h[6], &h[7], &h[8], &h[9], &h[10], &h[11], &h[12], &h[13], &h[14], &h[15], &h[16], &h[17], &h[18], &h[19], &h[20], &h[21], &h[22], &h[23]) != 26)
+            continue;
+        if (nyr > 1900)
+            nyr = nyr - 1900;
+        if (nyr < 50)
+            nyr = nyr + 100;
+        double d1950 = (nyr-50)*365 + ((nyr-1)/4-12) + nday;
+        if (n == 0)
+            sw->dtc1950 = d1950;
+        else if (d1950 != sw->dtc1950 + n/24){
+            fprintf(stderr, "\nError in '%s': data gap in DTC data at %d %d\n\n", loc_dtc, nyr+1900, nday);
+            exit(-1);
+        }
+        for (int i = 0; i < 24; i++){
+            if (h[i] > 2000){
+                fprintf(stderr, "\nError in '%s': missing DTC value at %d %d\n\n", loc_dtc, nyr+1900, nday);
+                exit(-1);
+            }
+            sw->dtc[n++] = h[i];
+        }
+    }
+    fclose(fp);
+    sw->n_dtc = n;
+    
+}
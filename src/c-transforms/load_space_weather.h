@@ -0,0 +1,45 @@
+//
+//  load_space_weather.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_space_weather.c
+//%
+//% DESCRIPTION:          This function builds the space-weather store used by
+//%                       the atmospheric and wind models. The NRLMSISE-00 ap
+//%                       history is precomputed for every 3-hour slot and the
+//%                       lagged JB2008 solar indices for every day, so that
+//%                       all lookups during propagation are a direct index.
+//%                       The JB2008 solar indices ('SOLFSMY.TXT') and
+//%                       geomagnetic storm temperatures ('DTCFILE.TXT') are
+//%                       only read if JB2008 is selected
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int length_of_file[5]: length of input text files
+//%                       double ap_index[length_of_file[0]]: 3-hour Ap values,
+//%                         starting 3 days before January 1, 2000
+//%                       double solar_input[length_of_file[1]][3]: daily
+//%                         F10.7, 81-day F10.7 and Ap, starting January 1, 2000
+//%                       int atmos_model: which atmospheric model?
+//%
+//% OUTPUT:               struct space_weather *sw: space-weather store
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_space_weather_h
+#define load_space_weather_h
+
+#include <stdio.h>
+#include "space_weather.h"
+
+void load_space_weather(int length_of_file[5], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], int atmos_model, struct space_weather *sw);
+
+#endif /* load_space_weather_h */
@@ -15,8 +15,10 @@
 //% DATE:                 October 27, 2017
 //% VERSION:              1
 //%
-//% INPUT:                double eop[6479][10]: earth orientation parameters
-//%                       double model_parameters[27]: model parameters
+//% INPUT:                int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%                       const struct time_scales *ts: leap second table
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
 //%                       double max_dates[5][3]: maximum dates from input files
 //%
 //% OUTPUT:               double sc_parameters[33]:
@@ -34,6 +36,8 @@
 //%
 //% COUPLING:             - days2mdh.c
 //%                       - t2doy.c
+//%                       - leap_seconds.c
+//%                       - eop_interp.c
 //%                       - state2orbital.c
 //%                       - orbital2state.c
 //%
@@ -48,10 +52,12 @@
 #include <stdlib.h>
 #include <errno.h>
 #include "t2doy.h"
+#include "leap_seconds.h"
+#include "eop_interp.h"
 
 extern int errno ;
 
-void load_teme(double eop[6479][10], double sc_parameters[33], double time_parameters[13], double model_parameters[27], double max_dates[5][3]){
+void load_teme(int n_eop, double eop[n_eop][10], const struct time_scales *ts, double sc_parameters[33], double time_parameters[13], double model_parameters[N_MODEL_PARAMETERS], double max_dates[5][3]){
     
     // Load R, V and t0 from input file;
     int errnum;
@@ -88,32 +94,24 @@ void load_teme(double eop[6479][10], double sc_parameters[33], double time_param
     double minutes = (hours-hour)*60;
     int minute = floor(minutes);
     double dut1 = eop[days][6]; // TLE output is UT1, need UTC.
+    if (model_parameters[37]==1){
+        // UT1-UTC interpolated to the TLE epoch
+        double eop_t[4];
+        eop_interp(n_eop, eop, days*24*60*60.0 + (doy-floor(doy))*24*60*60, eop_t);
+        dut1 = eop_t[2];
+    }
     double secs_utc = (minutes-minute)*60-dut1;
     double time[5];
     days2mdh(year, doy, time);
+    double t2000utc = days*24*60*60 + hour*60*60 + minute*60 + secs_utc;
     // From UTC to TAI (leap seconds)
-    double secs = secs_utc + 32;
-    if (year>2005)
-        secs = secs + 1;
-    if (year>2008)
-        secs = secs + 1;
-    if (year==2012&&time[0]>6)
-        secs = secs + 1;
-    else if (year>2012)
-        secs = secs + 1;
-    if (year==2015&&time[0]>6)
-        secs = secs + 1;
-    else if (year>2015)
-        secs = secs + 1;
-    if (year>2016)
-        secs = secs + 1;
+    double secs = secs_utc + leap_seconds(ts, t2000utc);
     // TAI to TT
     secs = secs + 32.184;
     time_parameters[0] = days;
     time_parameters[1] = hour;
     time_parameters[2] = minute;
     time_parameters[3] = secs;
-    double t2000utc = days*24*60*60 + hour*60*60 + minute*60 + secs_utc;
     
     // Add R and V info in parameter arrays (TEME reference frame)
     double p[3], v[3];
@@ -150,15 +148,17 @@ void load_teme(double eop[6479][10], double sc_parameters[33], double time_param
             }
         }
     }
-    if (model_parameters[5]==1 || model_parameters[7]==1 || model_parameters[8]==1){
+    const char *sun_file = (model_parameters[27]==2) ? "sun_cheb.bin" : "sun_ephemeris.txt";
+    const char *moon_file = (model_parameters[27]==2) ? "moon_cheb.bin" : "moon_ephemeris.txt";
+    if ((model_parameters[27]!=3) && (model_parameters[5]==1 || model_parameters[7]==1 || model_parameters[8]==1 || model_parameters[9]==1 || model_parameters[10]==1 || model_parameters[11]==1 || model_parameters[12]==1)){
         if ((time_finish[0]>max_dates[3][0]) || (time_finish[0]==max_dates[3][0]&&mdhms[0]>max_dates[3][1]) || (time_finish[0]==max_dates[3][0]&&mdhms[0]==max_dates[3][1]&&mdhms[1]>=max_dates[3][2])){
-            fprintf(stderr, "Error: Propagation period (%d-%d-%d) exceeds 'sun_ephemeris.txt' values (%d-%d-%d)\n", time_finish[0], (int)mdhms[0], (int)mdhms[1], (int)max_dates[3][0], (int)max_dates[3][1], (int)max_dates[3][2]);
+            fprintf(stderr, "Error: Propagation period (%d-%d-%d) exceeds '%s' values (%d-%d-%d)\n", time_finish[0], (int)mdhms[0], (int)mdhms[1], sun_file, (int)max_dates[3][0], (int)max_dates[3][1], (int)max_dates[3][2]);
             exit(-1);
         }
     }
-    if (model_parameters[6]==1){
+    if ((model_parameters[27]!=3) && (model_parameters[6]==1)){
         if ((time_finish[0]>max_dates[4][0]) || (time_finish[0]==max_dates[4][0]&&mdhms[0]>max_dates[4][1]) || (time_finish[0]==max_dates[4][0]&&mdhms[0]==max_dates[4][1]&&mdhms[1]>=max_dates[4][2])){
-            fprintf(stderr, "Error: Propagation period (%d-%d-%d) exceeds 'moon_ephemeris.txt' values (%d-%d-%d)\n", time_finish[0], (int)mdhms[0], (int)mdhms[1], (int)max_dates[4][0], (int)max_dates[4][1], (int)max_dates[4][2]);
+            fprintf(stderr, "Error: Propagation period (%d-%d-%d) exceeds '%s' values (%d-%d-%d)\n", time_finish[0], (int)mdhms[0], (int)mdhms[1], moon_file, (int)max_dates[4][0], (int)max_dates[4][1], (int)max_dates[4][2]);
             exit(-1);
         }
     }
@@ -15,8 +15,10 @@
 //% DATE:                 October 27, 2017
 //% VERSION:              1
 //%
-//% INPUT:                double eop[6479][10]: earth orientation parameters
-//%                       double model_parameters[28]: model parameters
+//% INPUT:                int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%                       const struct time_scales *ts: leap second table
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
 //%                       double max_dates[5][3]: maximum dates from input files
 //%
 //% OUTPUT:               double sc_parameters[33]:
@@ -34,6 +36,8 @@
 //%
 //% COUPLING:             - days2mdh.c
 //%                       - t2doy.c
+//%                       - leap_seconds.c
+//%                       - eop_interp.c
 //%                       - state2orbital.c
 //%                       - orbital2state.c
 //%
@@ -43,7 +47,9 @@
 #define load_teme_h
 
 #include <stdio.h>
+#include "load_model_parameters.h"
+#include "time_scales.h"
 
-void load_teme(double eop[6479][10], double sc_parameters[33], double time_parameters[13], double model_parameters[27], double max_dates[5][3]);
+void load_teme(int n_eop, double eop[n_eop][10], const struct time_scales *ts, double sc_parameters[33], double time_parameters[13], double model_parameters[N_MODEL_PARAMETERS], double max_dates[5][3]);
 
 #endif /* load_teme_h */
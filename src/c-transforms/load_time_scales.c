@@ -0,0 +1,78 @@
+//
+//  load_time_scales.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_time_scales.c
+//%
+//% DESCRIPTION:          This function loads the leap second table
+//%                       (data/leap_seconds.txt, IERS Bulletin C) used to
+//%                       convert between UTC and TAI
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               struct time_scales *ts: leap second table (the
+//%                         epoch cache is reset)
+//%
+//% COUPLING:             - date2days.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "load_time_scales.h"
+#include "date2days.h"
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+
+void load_time_scales(struct time_scales *ts){
+    
+    int errnum;
+    char loc_leap[500] = "data/leap_seconds.txt";
+    FILE *fp = fopen(loc_leap,"r");
+    if (fp == NULL){
+        errnum = errno;
+        fprintf(stderr, "\nError opening file '%s': %s\n\n", loc_leap, strerror( errnum ));
+        exit(-1);
+    }
+    
+    // Lines starting with '%' are comments
+    char line[500];
+    int year, month, day;
+    double dat;
+    ts->n_leap = 0;
+    while (fgets(line, 500, fp) != NULL){
+        if (line[0] == '%')
+            continue;
+        if (sscanf(line, "%d %d %d %lf", &year, &month, &day, &dat) != 4)
+            continue;
+        if (ts->n_leap == TIME_SCALES_MAX_LEAP){
+            fprintf(stderr, "\nError in '%s': more than %d leap second entries\n\n", loc_leap, TIME_SCALES_MAX_LEAP);
+            exit(-1);
+        }
+        double t = date2days(year, month, day)*24*60*60.0;
+        if (ts->n_leap > 0 && t <= ts->leap_t2000utc[ts->n_leap-1]){
+            fprintf(stderr, "\nError in '%s': leap second entries are not in chronological order\n\n", loc_leap);
+            exit(-1);
+        }
+        ts->leap_t2000utc[ts->n_leap] = t;
+        ts->leap_dat[ts->n_leap] = dat;
+        ts->n_leap++;
+    }
+    fclose(fp);
+    if (ts->n_leap == 0){
+        fprintf(stderr, "\nError in '%s': no leap second entries\n\n", loc_leap);
+        exit(-1);
+    }
+    
+    ts->valid = 0;
+    ts->n_calls = 0;
+    ts->n_updates = 0;
+    
+}
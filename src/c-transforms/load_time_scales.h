@@ -0,0 +1,36 @@
+//
+//  load_time_scales.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        load_time_scales.c
+//%
+//% DESCRIPTION:          This function loads the leap second table
+//%                       (data/leap_seconds.txt, IERS Bulletin C) used to
+//%                       convert between UTC and TAI
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               struct time_scales *ts: leap second table (the
+//%                         epoch cache is reset)
+//%
+//% COUPLING:             - date2days.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef load_time_scales_h
+#define load_time_scales_h
+
+#include <stdio.h>
+#include "time_scales.h"
+
+void load_time_scales(struct time_scales *ts);
+
+#endif /* load_time_scales_h */
@@ -0,0 +1,58 @@
+//
+//  magnet_arc.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_arc.h
+//%
+//% DESCRIPTION:          This structure contains the along-track Chebyshev
+//%                       fit of the magnetic field used by
+//%                       magnet_field_arc.c: the current orbit arc, the
+//%                       coefficients of the inertial position, magnetic
+//%                       field and its time derivative over the arc, and
+//%                       statistics
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int magnet_arc.valid: 0 if no arc, 1 otherwise
+//%                       double magnet_arc.t0, t1: start and end of the arc
+//%                         (s since January 1, 2000, 00:00:00 UTC)
+//%                       double magnet_arc.coef[9][MAGNET_ARC_NCOEF]:
+//%                         Chebyshev coefficients of the predicted position
+//%                         (m), magnetic field (T) and its time derivative
+//%                         (T s-1) in inertial frame
+//%                       long magnet_arc.n_calls: number of requests
+//%                       long magnet_arc.n_fits: number of arcs fitted
+//%                       long magnet_arc.n_drift: arcs refitted because the
+//%                         trajectory left the predicted one
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef magnet_arc_h
+#define magnet_arc_h
+
+#define MAGNET_ARC_NPTS 16      // samples per arc
+#define MAGNET_ARC_NCOEF 12     // Chebyshev coefficients per component
+#define MAGNET_ARC_SPLIT 16     // arcs per orbit
+#define MAGNET_ARC_DRIFT 1000   // position error triggering a new arc (m)
+
+struct magnet_arc
+{
+    // Arc
+    int valid;
+    double t0;
+    double t1;
+    double coef[9][MAGNET_ARC_NCOEF];
+    
+    // Statistics
+    long n_calls;
+    long n_fits;
+    long n_drift;
+};
+
+#endif /* magnet_arc_h */
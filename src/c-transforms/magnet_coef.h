@@ -0,0 +1,91 @@
+//
+//  magnet_coef.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_coef.h
+//%
+//% DESCRIPTION:          This structure contains the magnetic potential
+//%                       coefficients of IGRF-12 or WMM prepared by
+//%                       magnet_coef_update.c: the epoch data of the
+//%                       current window (one UTC day), the coefficients
+//%                       interpolated at the last requested time and their
+//%                       time derivatives. All coefficient arrays are
+//%                       14x14 (the WMM ones padded with zeros)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int magnet_coef.valid: 0 if no window, 1 if the
+//%                         window is set, 2 if the coefficients at time t
+//%                         are also set
+//%                       int magnet_coef.model: magnetic model of the window
+//%                       int magnet_coef.year: year of the window
+//%                       double magnet_coef.t_day: start of the window (s
+//%                         since January 1, 2000, 00:00:00 UTC)
+//%                       double magnet_coef.year_length: length of the year
+//%                         (s)
+//%                       double magnet_coef.year_start: start of the
+//%                         interpolation interval (decimal year)
+//%                       double magnet_coef.div: divisor of the
+//%                         coefficient increments (interval in years, 1
+//%                         for secular variation)
+//%                       double magnet_coef.G0[14][14], H0[14][14]:
+//%                         coefficients at year_start (nT)
+//%                       double magnet_coef.D_G[14][14], D_H[14][14]:
+//%                         coefficient increments over the interval (nT)
+//%                       double magnet_coef.S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]:
+//%                         Schmidt semi-normalization factors of the
+//%                         Legendre functions (set once by sph_schmidt.c)
+//%                       double magnet_coef.t: time of the interpolated
+//%                         coefficients (s since January 1, 2000, 00:00:00
+//%                         UTC)
+//%                       double magnet_coef.G_t[14][14], H_t[14][14]:
+//%                         coefficients at time t (nT)
+//%                       double magnet_coef.dG_t[14][14], dH_t[14][14]:
+//%                         time derivatives of the coefficients (nT s-1)
+//%                       long magnet_coef.n_calls: number of requests
+//%                       long magnet_coef.n_windows: number of windows set
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef magnet_coef_h
+#define magnet_coef_h
+
+#include "sph_schmidt.h"
+
+struct magnet_coef
+{
+    // Epoch window
+    int valid;
+    int model;
+    int year;
+    double t_day;
+    double year_length;
+    double year_start;
+    double div;
+    double G0[14][14];
+    double H0[14][14];
+    double D_G[14][14];
+    double D_H[14][14];
+    
+    // Schmidt semi-normalization factors of the Legendre functions
+    double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM];
+    
+    // Coefficients at time t and their time derivatives
+    double t;
+    double G_t[14][14];
+    double H_t[14][14];
+    double dG_t[14][14];
+    double dH_t[14][14];
+    
+    // Statistics
+    long n_calls;
+    long n_windows;
+};
+
+#endif /* magnet_coef_h */
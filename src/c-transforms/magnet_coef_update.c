@@ -0,0 +1,149 @@
+//
+//  magnet_coef_update.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_coef_update.c
+//%
+//% DESCRIPTION:          This function prepares the IGRF-12 or WMM
+//%                       magnetic potential coefficients and their time
+//%                       derivatives at the requested time. The epoch
+//%                       selection and the coefficient increments are only
+//%                       set when the time leaves the current window (one
+//%                       UTC day, as the decimal year of magnet_field.c is
+//%                       counted from the start of the day), and the
+//%                       interpolation is only done when the time changes,
+//%                       so all calls at the same time share the
+//%                       coefficients. The values are the same as those
+//%                       previously computed in magnet_field.c. The
+//%                       Schmidt semi-normalization factors of the cache
+//%                       do not depend on the epoch and are set once by
+//%                       sph_schmidt.c when the cache is created
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct magnet_coef *mc: coefficient cache
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       int magnetic_model: 1 for IGRF-12, 2 for WMM
+//%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
+//%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
+//%
+//% OUTPUT:               struct magnet_coef *mc: coefficients at t2000utc
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "magnet_coef_update.h"
+#include "t2doy.h"
+
+void magnet_coef_update(struct magnet_coef *mc, double t2000utc, int magnetic_model, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8]){
+    
+    mc->n_calls++;
+    
+    // New epoch window
+    if ((mc->valid == 0) || (magnetic_model != mc->model) || (t2000utc < mc->t_day) || (t2000utc >= mc->t_day + 24*60*60)){
+        
+        int time[3];
+        double sec = t2doy(t2000utc, time);
+        mc->model = magnetic_model;
+        mc->year = time[0];
+        mc->t_day = t2000utc - sec;
+        if (time[0] % 4 == 0)
+            mc->year_length = 366*24*60*60;
+        else
+            mc->year_length = 365*24*60*60;
+        
+        int k;
+        if (magnetic_model == 1){
+            
+            // IGRF-12: interpolation between 5-year epochs, secular
+            // variation after the last one
+            if (time[0] < 2005)
+                k = 20;
+            else if (time[0] < 2010)
+                k = 21;
+            else if (time[0] < 2015)
+                k = 22;
+            else
+                k = 23;
+            mc->year_start = (k+380)*5;
+            mc->div = (k<23) ? 5.0 : 1.0;
+            for (int i=0; i<14; i++){
+                for (int j=0; j<14; j++){
+                    mc->G0[i][j] = G[i][j][k];
+                    mc->H0[i][j] = H[i][j][k];
+                    if (k<23){
+                        mc->D_G[i][j] = G[i][j][k+1]-G[i][j][k];
+                        mc->D_H[i][j] = H[i][j][k+1]-H[i][j][k];
+                        mc->dG_t[i][j] = (G[i][j][k+1]-G[i][j][k])/(5.0*365.25*24*60*60);
+                        mc->dH_t[i][j] = (H[i][j][k+1]-H[i][j][k])/(5.0*365.25*24*60*60);
+                    }
+                    else {
+                        mc->D_G[i][j] = G[i][j][k+1];
+                        mc->D_H[i][j] = H[i][j][k+1];
+                        mc->dG_t[i][j] = G[i][j][k+1]/(365.25*24*60*60);
+                        mc->dH_t[i][j] = H[i][j][k+1]/(365.25*24*60*60);
+                    }
+                }
+            }
+        }
+        else {
+            
+            // WMM: secular variation from each 5-year epoch
+            if (time[0] < 2005)
+                k = 0;
+            else if (time[0] < 2010)
+                k = 2;
+            else if (time[0] < 2015)
+                k = 4;
+            else
+                k = 6;
+            mc->year_start = 2000 + (k/2.0)*5;
+            mc->div = 1.0;
+            for (int i=0; i<14; i++){
+                for (int j=0; j<14; j++){
+                    if ((i<13) && (j<13)){
+                        mc->G0[i][j] = G_wmm[i][j][k];
+                        mc->H0[i][j] = H_wmm[i][j][k];
+                        mc->D_G[i][j] = G_wmm[i][j][k+1];
+                        mc->D_H[i][j] = H_wmm[i][j][k+1];
+                        mc->dG_t[i][j] = G_wmm[i][j][k+1]/(365.25*24*60*60);
+                        mc->dH_t[i][j] = H_wmm[i][j][k+1]/(365.25*24*60*60);
+                    }
+                    else {
+                        mc->G0[i][j] = 0;
+                        mc->H0[i][j] = 0;
+                        mc->D_G[i][j] = 0;
+                        mc->D_H[i][j] = 0;
+                        mc->dG_t[i][j] = 0;
+                        mc->dH_t[i][j] = 0;
+                    }
+                }
+            }
+        }
+        mc->valid = 1;
+        mc->n_windows++;
+    }
+    
+    // Interpolate G and H linearly
+    if ((mc->valid == 2) && (t2000utc == mc->t))
+        return;
+    double year_decimal = mc->year + (t2000utc - mc->t_day)/mc->year_length;
+    for (int i=0; i<14; i++){
+        for (int j=0; j<14; j++){
+            mc->G_t[i][j] = mc->G0[i][j]+(year_decimal-mc->year_start)*mc->D_G[i][j]/mc->div;
+            mc->H_t[i][j] = mc->H0[i][j]+(year_decimal-mc->year_start)*mc->D_H[i][j]/mc->div;
+        }
+    }
+    mc->t = t2000utc;
+    mc->valid = 2;
+    
+}
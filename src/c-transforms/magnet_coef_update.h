@@ -0,0 +1,52 @@
+//
+//  magnet_coef_update.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_coef_update.c
+//%
+//% DESCRIPTION:          This function prepares the IGRF-12 or WMM
+//%                       magnetic potential coefficients and their time
+//%                       derivatives at the requested time. The epoch
+//%                       selection and the coefficient increments are only
+//%                       set when the time leaves the current window (one
+//%                       UTC day, as the decimal year of magnet_field.c is
+//%                       counted from the start of the day), and the
+//%                       interpolation is only done when the time changes,
+//%                       so all calls at the same time share the
+//%                       coefficients. The values are the same as those
+//%                       previously computed in magnet_field.c. The
+//%                       Schmidt semi-normalization factors of the cache
+//%                       do not depend on the epoch and are set once by
+//%                       sph_schmidt.c when the cache is created
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct magnet_coef *mc: coefficient cache
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       int magnetic_model: 1 for IGRF-12, 2 for WMM
+//%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
+//%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
+//%
+//% OUTPUT:               struct magnet_coef *mc: coefficients at t2000utc
+//%
+//% COUPLING:             - t2doy.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef magnet_coef_update_h
+#define magnet_coef_update_h
+
+#include <stdio.h>
+#include "magnet_coef.h"
+
+void magnet_coef_update(struct magnet_coef *mc, double t2000utc, int magnetic_model, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8]);
+
+#endif /* magnet_coef_update_h */
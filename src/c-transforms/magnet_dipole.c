@@ -0,0 +1,90 @@
+//
+//  magnet_dipole.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_dipole.c
+//%
+//% DESCRIPTION:          This function will calculate the magnetic field
+//%                       vector and its time derivative at the satellite
+//%                       position from the eccentric (tilted and offset)
+//%                       dipole of the IGRF-12 or WMM coefficients. The
+//%                       dipole moment is given by the degree 1
+//%                       coefficients and its centre by the degree 2
+//%                       coefficients (Fraser-Smith, 1987)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double p_LLA[3]: position in ECEF frame (m)
+//%                       double v_LLA[3]: velocity in ECEF frame (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
+//%                       const struct magnet_coef *mc: magnetic potential
+//%                         coefficients and their time derivatives
+//%
+//% OUTPUT:               double B_field_i[3]: magnetic field vector in inertial frame
+//%                       double B_field_i_dot[3]: time derivative of magnetic field
+//%                         vector in inertial frame as seen from orbiting
+//%                         spacecraft
+//%
+//% COUPLING:             - linalg.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "magnet_dipole.h"
+#include "linalg.h"
+#include <math.h>
+
+void magnet_dipole(double p_LLA[3], double v_LLA[3], double C_ecef2teme[3][3], const struct magnet_coef *mc, double B_field_i[3], double B_field_i_dot[3]){
+    
+    // Constants
+    double a = 6371200; // Geomagnetic conventional Earth’s mean reference spherical radius
+    
+    // Dipole moment and its time derivative in ECEF frame (nT)
+    double g[3] = {mc->G_t[1][1], mc->H_t[1][1], mc->G_t[1][0]};
+    double g_dot[3] = {mc->dG_t[1][1], mc->dH_t[1][1], mc->dG_t[1][0]};
+    
+    // Dipole centre from degree 2 coefficients (m)
+    double B0_2 = vec3_dot(g,g);
+    double g20 = mc->G_t[2][0], g21 = mc->G_t[2][1], h21 = mc->H_t[2][1], g22 = mc->G_t[2][2], h22 = mc->H_t[2][2];
+    double L0 = 2*g[2]*g20 + sqrt(3)*(g[0]*g21 + g[1]*h21);
+    double L1 = -g[0]*g20 + sqrt(3)*(g[2]*g21 + g[0]*g22 + g[1]*h22);
+    double L2 = -g[1]*g20 + sqrt(3)*(g[2]*h21 - g[1]*g22 + g[0]*h22);
+    double E = (L0*g[2] + L1*g[0] + L2*g[1])/(4*B0_2);
+    double centre[3] = {a*(L1 - g[0]*E)/(3*B0_2), a*(L2 - g[1]*E)/(3*B0_2), a*(L0 - g[2]*E)/(3*B0_2)};
+    
+    // Position relative to the dipole centre
+    double r_vec[3];
+    for (int i=0; i<3; i++)
+        r_vec[i] = p_LLA[i] - centre[i];
+    double r = sqrt(vec3_dot(r_vec,r_vec));
+    double r3 = r*r*r, r5 = r3*r*r, r7 = r5*r*r;
+    double a3 = a*a*a;
+    double gr = vec3_dot(g,r_vec);
+    double gv = vec3_dot(g,v_LLA);
+    double rv = vec3_dot(r_vec,v_LLA);
+    double gr_dot = vec3_dot(g_dot,r_vec);
+    
+    // Magnetic field (B = -grad(V) with V = a^3 (g.r)/r^3) and its rate
+    // along the trajectory and from secular variation, in ECEF frame
+    double B_field_ecef[3], B_field_ecef_dot[3];
+    for (int i=0; i<3; i++){
+        B_field_ecef[i] = a3*(3*gr*r_vec[i]/r5 - g[i]/r3)*pow(10,-9);
+        B_field_ecef_dot[i] = a3*(3*(gv*r_vec[i] + gr*v_LLA[i] + rv*g[i])/r5 - 15*gr*rv*r_vec[i]/r7)*pow(10,-9);
+        B_field_ecef_dot[i] = B_field_ecef_dot[i] + a3*(3*gr_dot*r_vec[i]/r5 - g_dot[i]/r3)*pow(10,-9);
+    }
+    mat3_vec(C_ecef2teme,B_field_ecef,B_field_i);
+    
+    // Rotate to inertial frame
+    double omegaearth[3] = {0, 0, 7.29211514670698e-05};
+    double wxB_ecef[3];
+    vec3_cross(omegaearth,B_field_ecef,wxB_ecef);
+    for (int i=0; i<3; i++)
+        B_field_ecef_dot[i] = B_field_ecef_dot[i] + wxB_ecef[i];
+    mat3_vec(C_ecef2teme,B_field_ecef_dot,B_field_i_dot);
+    
+}
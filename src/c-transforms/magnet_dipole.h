@@ -0,0 +1,46 @@
+//
+//  magnet_dipole.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_dipole.c
+//%
+//% DESCRIPTION:          This function will calculate the magnetic field
+//%                       vector and its time derivative at the satellite
+//%                       position from the eccentric (tilted and offset)
+//%                       dipole of the IGRF-12 or WMM coefficients. The
+//%                       dipole moment is given by the degree 1
+//%                       coefficients and its centre by the degree 2
+//%                       coefficients (Fraser-Smith, 1987)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double p_LLA[3]: position in ECEF frame (m)
+//%                       double v_LLA[3]: velocity in ECEF frame (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
+//%                       const struct magnet_coef *mc: magnetic potential
+//%                         coefficients and their time derivatives
+//%
+//% OUTPUT:               double B_field_i[3]: magnetic field vector in inertial frame
+//%                       double B_field_i_dot[3]: time derivative of magnetic field
+//%                         vector in inertial frame as seen from orbiting
+//%                         spacecraft
+//%
+//% COUPLING:             - linalg.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef magnet_dipole_h
+#define magnet_dipole_h
+
+#include <stdio.h>
+#include "magnet_coef.h"
+
+void magnet_dipole(double p_LLA[3], double v_LLA[3], double C_ecef2teme[3][3], const struct magnet_coef *mc, double B_field_i[3], double B_field_i_dot[3]);
+
+#endif /* magnet_dipole_h */
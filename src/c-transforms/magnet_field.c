@@ -10,14 +10,14 @@
 //%
 //% DESCRIPTION:          This function will calculate the magnetic field
 //%                       vector and its time derivative at the satellite position
+//%                       (IGRF-12 or WMM, from the coefficients prepared by
+//%                       magnet_coef_update.c)
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 September 11, 2016
 //% VERSION:              1
 //%
-//% INPUT:                double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
-//%                       double p[3]: position in TEME frame (m)
-//%                       double p_LLA[3]: position in ECEF frame (m)
+//% INPUT:                double p_LLA[3]: position in ECEF frame (m)
 //%                       double v_LLA[3]: velocity in ECEF frame (m s-1)
 //%                       double LLA[4]:
 //%                         - LLA[0]: geocentric latitude (rad)
@@ -25,90 +25,35 @@
 //%                         - LLA[2]: longitude (rad)
 //%                         - LLA[3]: altitude (km)
 //%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
-//%                       double G[14][14][25]: magnetic potential coefficients
-//%                       double H[14][14][25]: magnetic potential coefficients
+//%                       const struct magnet_coef *mc: magnetic potential
+//%                         coefficients of the current epoch and their
+//%                         time derivatives (see magnet_coef_update.c)
+//%                       int l_max: maximum degree in spherical harmonic
+//%                         expansion (13 for the full IGRF-12 model, 12
+//%                         for the full WMM model)
 //%
 //% OUTPUT:               double B_field_i[3]: magnetic field vector in inertial frame
 //%                       double B_field_i_dot[3]: time derivative of magnetic field
 //%                         vector in inertial frame as seen from orbiting
 //%                         spacecraft
 //%
-//% COUPLING:             - t2doy.c
-//%                       - crossprod.c
-//%                       - invertmat.c
-//%                       - matxvec.c
+//% COUPLING:             - linalg.h
+//%                       - sph_legendre.c
+//%                       - sph_synthesis.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "magnet_field.h"
-#include "t2doy.h"
+#include "linalg.h"
 #include <math.h>
-#include "matxvec.h"
-#include "invertmat.h"
-#include "crossprod.h"
+#include "sph_legendre.h"
+#include "sph_synthesis.h"
 
-void magnet_field(double t2000utc, double p[3], double p_LLA[3], double v_LLA[3], double LLA[4], double C_ecef2teme[3][3], double G[14][14][25], double H[14][14][25], double B_field_i[3], double B_field_i_dot[3]){
+void magnet_field(double p_LLA[3], double v_LLA[3], double LLA[4], double C_ecef2teme[3][3], const struct magnet_coef *mc, int l_max, double B_field_i[3], double B_field_i_dot[3]){
     
     // Constants
     double a = 6371200; // Geomagnetic conventional Earth’s mean reference spherical radius
     
-    // Get Decimal Year
-    double sec, year_decimal;
-    int time[3];
-    sec = t2doy(t2000utc, time);
-    if (time[0] % 4 == 0)
-        year_decimal = time[0] + sec/(366*24*60*60);
-    else
-        year_decimal = time[0] + sec/(365*24*60*60);
-    
-    // Interpolate G and H linearly
-    double G_t[14][14], H_t[14][14];
-    int k;
-    if (time[0] < 2005)
-        k = 20;
-    else if (time[0] < 2010)
-        k = 21;
-    else if (time[0] < 2015)
-        k = 22;
-    else
-        k = 23;
-    double year_start = (k+380)*5;
-    if (k<23){
-        for (int i=0; i<14; i++){
-            for (int j=0; j<14; j++){
-                G_t[i][j] = G[i][j][k]+(year_decimal-year_start)*(G[i][j][k+1]-G[i][j][k])/5.0;
-                H_t[i][j] = H[i][j][k]+(year_decimal-year_start)*(H[i][j][k+1]-H[i][j][k])/5.0;
-            }
-        }
-    }
-    else if (k==23){
-        for (int i=0; i<14; i++){
-            for (int j=0; j<14; j++){
-                G_t[i][j] = G[i][j][k]+(year_decimal-year_start)*G[i][j][k+1];
-                H_t[i][j] = H[i][j][k]+(year_decimal-year_start)*H[i][j][k+1];
-            }
-        }
-    }
-    
-    // Time derivative of G and H
-    double dG_t[14][14], dH_t[14][14];
-    if (k<23){
-        for (int i=0; i<14; i++){
-            for (int j=0; j<14; j++){
-                dG_t[i][j] = (G[i][j][k+1]-G[i][j][k])/(5.0*365.25*24*60*60);
-                dH_t[i][j] = (H[i][j][k+1]-H[i][j][k])/(5.0*365.25*24*60*60);
-            }
-        }
-    }
-    else if (k==23){
-        for (int i=0; i<14; i++){
-            for (int j=0; j<14; j++){
-                dG_t[i][j] = G[i][j][k+1]/(365.25*24*60*60);
-                dH_t[i][j] = H[i][j][k+1]/(365.25*24*60*60);
-            }
-        }
-    }
-    
     // Spherical geocentric distance, longitude and latitude (declination), and colatitude (m and rad)
     double r = sqrt(p_LLA[0]*p_LLA[0] + p_LLA[1]*p_LLA[1] + p_LLA[2]*p_LLA[2]);
     double lon = LLA[2];
@@ -122,98 +67,31 @@ void magnet_field(double t2000utc, double p[3], double p_LLA[3], double v_LLA[3]
         colat=179.99999999*M_PI/180.0;
     
     // Calculate Schmidt normalized associated Legendre functions
-    double P[14][14];
-    double dP[14][14];
-    double ddP[14][14];
-    double S[14][14];
-    for (int i=1; i<14; i++){
-        for (int j=1; j<14; j++){
-            P[i][j]=0;
-            dP[i][j]=0;
-            ddP[i][j]=0;
-            S[i][j]=0;
-        }
-    }
-    P[0][0] = 1;
-    P[1][0] = cos(colat);
-    for (int n=1; n<14; n++)
-        P[n][n] = sin(colat)*P[n-1][n-1];
-    for (int n=2; n<14; n++){
-        for(int m=0; m<n; m++)
-            P[n][m] = cos(colat)*P[n-1][m] - ((n-1)*(n-1)-m*m)*P[n-2][m]/((2*n-1)*(2*n-3));
-    }
-    dP[0][0] = 0;
-    dP[1][0] = -sin(colat);
-    for (int n=1; n<14; n++)
-        dP[n][n] = sin(colat)*dP[n-1][n-1] + cos(colat)*P[n-1][n-1];
-    for (int n=2; n<14; n++){
-        for (int m=0; m<n; m++)
-            dP[n][m] = cos(colat)*dP[n-1][m] - sin(colat)*P[n-1][m] - ((n-1)*(n-1)-m*m)*dP[n-2][m]/((2*n-1)*(2*n-3));
-    }
-    ddP[0][0] = 0;
-    ddP[1][0] = -cos(colat);
-    for (int n=1; n<14; n++)
-        ddP[n][n] = 2*cos(colat)*dP[n-1][n-1] - sin(colat)*P[n-1][n-1] + sin(colat)*ddP[n-1][n-1];
-    for (int n=2; n<14; n++){
-        for (int m=0; m<n; m++)
-            ddP[n][m] = cos(colat)*ddP[n-1][m] - 2*sin(colat)*dP[n-1][m] - cos(colat)*P[n-1][m] - ((n-1)*(n-1)-m*m)*ddP[n-2][m]/((2*n-1)*(2*n-3));
-    }
-    double delta;
-    S[0][0] = 1;
-    for (int n=1; n<14; n++)
-        S[n][0] = S[n-1][0]*(2*n-1)/n;
-    for (int n=1; n<14; n++){
-        for (int m=1; m<=n; m++){
-            if (m==1)
-                delta = 1;
-            else
-                delta = 0;
-            S[n][m] = S[n][m-1]*sqrt((n-m+1)*(delta+1)/(n+m));
-        }
-    }
-    for (int n=0; n<14; n++){
-        for (int m=0; m<=n; m++){
-            P[n][m] = P[n][m] *S[n][m];
-            dP[n][m] = dP[n][m] *S[n][m];
-            ddP[n][m] = ddP[n][m] *S[n][m];
-        }
-    }
+    int dim = l_max+3;
+    double P[dim][dim];
+    double dP[dim][dim];
+    double ddP[dim][dim];
+    sph_legendre(SPH_SCHMIDT, 2, l_max, colat, dim, mc->S, P, dP, ddP);
     
     // Partial Derivatives
-    double dVdr = 0;
-    double dVd0 = 0;
-    double dVdl = 0;
-    for (int l = 1; l <=13 ; l++ ){
-        for (int m = 0; m<=l; m++){
-            dVdr = dVdr - pow(a/r,l+2)*(l+1)*P[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            dVd0 = dVd0 + a*pow(a/r,l+1)*dP[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            dVdl = dVdl + a*pow(a/r,l+1)*m*P[l][m]*(H_t[l][m]*cos(m*lon)-G_t[l][m]*sin(m*lon));
-        }
-    }
+    double rho = a/r;
+    double sums[10], sums_t[10];
+    sph_synthesis(2, 1, l_max, rho, lon, dim, P, dP, ddP, 14, mc->G_t, mc->H_t, sums);
+    double dVdr = -rho*rho*sums[1];
+    double dVd0 = a*rho*sums[2];
+    double dVdl = a*rho*sums[3];
     
     // Second Partial Derivatives
-    double d2Vdr2 = 0;
-    double d2Vd0dr = 0;
-    double d2Vdldr = 0;
-    double d2Vdtdr = 0;
-    double d2Vd02 = 0;
-    double d2Vdld0 = 0;
-    double d2Vdtd0 = 0;
-    double d2Vdl2 = 0;
-    double d2Vdtdl = 0;
-    for (int l = 1; l <=13 ; l++ ){
-        for (int m = 0; m<=l; m++){
-            d2Vdr2 = d2Vdr2 + 1/r*pow(a/r,l+2)*(l+2)*(l+1)*P[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            d2Vd0dr = d2Vd0dr - pow(a/r,l+2)*(l+1)*dP[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            d2Vdldr = d2Vdldr + pow(a/r,l+2)*(l+1)*m*P[l][m]*(G_t[l][m]*sin(m*lon)-H_t[l][m]*cos(m*lon));
-            d2Vdtdr = d2Vdtdr - pow(a/r,l+2)*(l+1)*P[l][m]*(dG_t[l][m]*cos(m*lon)+dH_t[l][m]*sin(m*lon));
-            d2Vd02 = d2Vd02 + a*pow(a/r,l+1)*ddP[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            d2Vdld0 = d2Vdld0 + a*pow(a/r,l+1)*m*dP[l][m]*(H_t[l][m]*cos(m*lon)-G_t[l][m]*sin(m*lon));
-            d2Vdtd0 = d2Vdtd0 + a*pow(a/r,l+1)*dP[l][m]*(dG_t[l][m]*cos(m*lon)+dH_t[l][m]*sin(m*lon));
-            d2Vdl2 = d2Vdl2 - a*pow(a/r,l+1)*m*m*P[l][m]*(G_t[l][m]*cos(m*lon)+H_t[l][m]*sin(m*lon));
-            d2Vdtdl = d2Vdtdl + a*pow(a/r,l+1)*m*P[l][m]*(dH_t[l][m]*cos(m*lon)-dG_t[l][m]*sin(m*lon));
-        }
-    }
+    sph_synthesis(1, 1, l_max, rho, lon, dim, P, dP, ddP, 14, mc->dG_t, mc->dH_t, sums_t);
+    double d2Vdr2 = rho*rho/r*sums[4];
+    double d2Vd0dr = -rho*rho*sums[7];
+    double d2Vdldr = -rho*rho*sums[8];
+    double d2Vdtdr = -rho*rho*sums_t[1];
+    double d2Vd02 = a*rho*sums[5];
+    double d2Vdld0 = a*rho*sums[9];
+    double d2Vdtd0 = a*rho*sums_t[2];
+    double d2Vdl2 = -a*rho*sums[6];
+    double d2Vdtdl = a*rho*sums_t[3];
     
     // Magnetic Field in Spherical Components
     double B_field_spherical[3];
@@ -233,14 +111,14 @@ void magnet_field(double t2000utc, double p[3], double p_LLA[3], double v_LLA[3]
         {-sin(lat)*sin(lon),    cos(lon),   -cos(lat)*sin(lon)},
         {cos(lat),              0,          -sin(lat)}};
     double B_field_ecef[3];
-    matxvec(C_ned2ecef,B_field_ned,B_field_ecef);
-    matxvec(C_ecef2teme,B_field_ecef,B_field_i);
+    mat3_vec(C_ned2ecef,B_field_ned,B_field_ecef);
+    mat3_vec(C_ecef2teme,B_field_ecef,B_field_i);
     
     // Velocity in Spherical Coordinates
     double v_sph[3], v_ned[3];
     double C_ecef2ned[3][3];
-    invertmat(C_ned2ecef,C_ecef2ned);
-    matxvec(C_ecef2ned, v_LLA,v_ned);
+    mat3_transpose(C_ned2ecef,C_ecef2ned);
+    mat3_vec(C_ecef2ned, v_LLA,v_ned);
     v_sph[0] = - v_ned[2];
     v_sph[1] = - v_ned[0];
     v_sph[2] = v_ned[1];
@@ -260,18 +138,18 @@ void magnet_field(double t2000utc, double p[3], double p_LLA[3], double v_LLA[3]
     // Rotate to ecef frame
     double w_ned[3] = {v_ned[1]/r, -v_ned[0]/r, 0};
     double wxB_ned[3];
-    crossprod(w_ned,B_field_ned,wxB_ned);
+    vec3_cross(w_ned,B_field_ned,wxB_ned);
     for (int i=0; i<3; i++)
         B_field_ned_dot[i] = B_field_ned_dot[i] + wxB_ned[i];
     double B_field_ecef_dot[3];
-    matxvec(C_ned2ecef,B_field_ned_dot,B_field_ecef_dot);
+    mat3_vec(C_ned2ecef,B_field_ned_dot,B_field_ecef_dot);
     
     // Rotate to inertial frame
     double omegaearth[3] = {0, 0, 7.29211514670698e-05};
     double wxB_ecef[3];
-    crossprod(omegaearth,B_field_ecef,wxB_ecef);
+    vec3_cross(omegaearth,B_field_ecef,wxB_ecef);
     for (int i=0; i<3; i++)
         B_field_ecef_dot[i] = B_field_ecef_dot[i] + wxB_ecef[i];
-    matxvec(C_ecef2teme,B_field_ecef_dot,B_field_i_dot);
+    mat3_vec(C_ecef2teme,B_field_ecef_dot,B_field_i_dot);
     
 }
@@ -0,0 +1,210 @@
+//
+//  magnet_field_arc.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_field_arc.c
+//%
+//% DESCRIPTION:          This function will calculate the magnetic field
+//%                       vector and its time derivative at the satellite
+//%                       position from an along-track Chebyshev fit. At the
+//%                       start of an arc (1/MAGNET_ARC_SPLIT of the orbital
+//%                       period), the trajectory is predicted from the
+//%                       current state (two-body and J2, Earth rotating at
+//%                       constant rate), the magnetic model is evaluated
+//%                       at MAGNET_ARC_NPTS Chebyshev nodes and the field
+//%                       and its derivative in inertial frame are fitted.
+//%                       A new arc is fitted when the time leaves the arc
+//%                       or the position is more than MAGNET_ARC_DRIFT
+//%                       from the predicted one
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct magnet_arc *ma: along-track fit
+//%                       struct magnet_coef *mc: magnetic potential
+//%                         coefficient cache (set at t2000utc when an arc
+//%                         is fitted; the nodes use a local copy)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double p[3]: position in TEME frame (m)
+//%                       double v[3]: velocity in TEME frame (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
+//%                       int magnetic_model: 1 for IGRF-12, 2 for WMM
+//%                       int l_max: maximum degree in spherical harmonic
+//%                         expansion
+//%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
+//%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
+//%
+//% OUTPUT:               double B_field_i[3]: magnetic field vector in inertial frame
+//%                       double B_field_i_dot[3]: time derivative of magnetic field
+//%                         vector in inertial frame as seen from orbiting
+//%                         spacecraft
+//%
+//% COUPLING:             - cheb_fit.c
+//%                       - cheb_series.c
+//%                       - linalg.h
+//%                       - magnet_coef_update.c
+//%                       - magnet_field.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "magnet_field_arc.h"
+#include "linalg.h"
+#include <math.h>
+#include "cheb_fit.h"
+#include "cheb_series.h"
+#include "magnet_coef_update.h"
+#include "magnet_field.h"
+
+// Two-body and J2 acceleration (TEME z axis taken as the rotation axis)
+static void arc_accel(double x[6], double dx[6]){
+    
+    double mu = 3986004.418*pow(10,8);
+    double J2 = 1.08262668e-3;
+    double R = 6378136.3;
+    double r2 = x[0]*x[0] + x[1]*x[1] + x[2]*x[2];
+    double r = sqrt(r2);
+    double k = 1.5*J2*mu*R*R/(r2*r2*r);
+    double z2 = x[2]*x[2]/r2;
+    for (int i=0; i<3; i++){
+        dx[i] = x[i+3];
+        dx[i+3] = -mu*x[i]/(r2*r);
+    }
+    dx[3] = dx[3] - k*x[0]*(1 - 5*z2);
+    dx[4] = dx[4] - k*x[1]*(1 - 5*z2);
+    dx[5] = dx[5] - k*x[2]*(3 - 5*z2);
+}
+
+// Fixed-step Runge-Kutta 4 from 0 to dt
+static void arc_predict(double x[6], double dt){
+    
+    int n = ceil(fabs(dt)/5.0);
+    if (n == 0)
+        return;
+    double h = dt/n;
+    for (int s=0; s<n; s++){
+        double k1[6], k2[6], k3[6], k4[6], xs[6];
+        arc_accel(x, k1);
+        for (int i=0; i<6; i++)
+            xs[i] = x[i] + 0.5*h*k1[i];
+        arc_accel(xs, k2);
+        for (int i=0; i<6; i++)
+            xs[i] = x[i] + 0.5*h*k2[i];
+        arc_accel(xs, k3);
+        for (int i=0; i<6; i++)
+            xs[i] = x[i] + h*k3[i];
+        arc_accel(xs, k4);
+        for (int i=0; i<6; i++)
+            x[i] = x[i] + h*(k1[i] + 2*k2[i] + 2*k3[i] + k4[i])/6.0;
+    }
+}
+
+void magnet_field_arc(struct magnet_arc *ma, struct magnet_coef *mc, double t2000utc, double p[3], double v[3], double C_ecef2teme[3][3], int magnetic_model, int l_max, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double B_field_i[3], double B_field_i_dot[3]){
+    
+    ma->n_calls++;
+    
+    // Point of the current arc closest to the position (the integrator
+    // stages of a step share the step time), and distance to it
+    double f[9], df[9], x = 0;
+    int fit = (ma->valid == 0) || (t2000utc < ma->t0) || (t2000utc > ma->t1);
+    if (!fit){
+        x = 2*(t2000utc - ma->t0)/(ma->t1 - ma->t0) - 1;
+        double dp[3];
+        for (int it=0; it<2; it++){
+            cheb_series(MAGNET_ARC_NCOEF, 9, (const double (*)[MAGNET_ARC_NCOEF]) ma->coef, x, f, df);
+            double dp_dx[3] = {df[0], df[1], df[2]};
+            for (int i=0; i<3; i++)
+                dp[i] = p[i] - f[i];
+            x = x + vec3_dot(dp,dp_dx)/vec3_dot(dp_dx,dp_dx);
+        }
+        cheb_series(MAGNET_ARC_NCOEF, 9, (const double (*)[MAGNET_ARC_NCOEF]) ma->coef, x, f, NULL);
+        for (int i=0; i<3; i++)
+            dp[i] = p[i] - f[i];
+        if ((x < -1) || (x > 1))
+            fit = 1;
+        else if (sqrt(vec3_dot(dp,dp)) > MAGNET_ARC_DRIFT){
+            fit = 1;
+            ma->n_drift++;
+        }
+    }
+    
+    // New arc from the current state
+    if (fit){
+        
+        // Arc length from the orbital period
+        double mu = 3986004.418*pow(10,8);
+        double r = sqrt(vec3_dot(p,p));
+        double sma = 1.0/(2.0/r - vec3_dot(v,v)/mu);
+        double T = 2*M_PI*sqrt(sma*sma*sma/mu)/MAGNET_ARC_SPLIT;
+        ma->t0 = t2000utc - 0.1*T;
+        ma->t1 = t2000utc + T;
+        
+        // Magnetic field along the predicted trajectory at Chebyshev nodes
+        // (in increasing time)
+        double omegaearth[3] = {0, 0, 7.29211514670698e-05};
+        double C_teme2ecef0[3][3];
+        mat3_transpose(C_ecef2teme, C_teme2ecef0);
+        double xs[6] = {p[0], p[1], p[2], v[0], v[1], v[2]};
+        double t_prev = 0;
+        
+        // Coefficients at the node times in a local copy, so that the
+        // shared cache stays at the current time
+        magnet_coef_update(mc, t2000utc, magnetic_model, G, H, G_wmm, H_wmm);
+        struct magnet_coef mc_node = *mc;
+        double x_node[MAGNET_ARC_NPTS], y_node[MAGNET_ARC_NPTS][9];
+        for (int k=0; k<MAGNET_ARC_NPTS; k++){
+            x_node[k] = -cos(M_PI*(k + 0.5)/MAGNET_ARC_NPTS);
+            double dt = ma->t0 - t2000utc + (x_node[k] + 1)/2*(ma->t1 - ma->t0);
+            arc_predict(xs, dt - t_prev);
+            t_prev = dt;
+            
+            // Earth-fixed frame rotated by the Earth rotation angle
+            double th = omegaearth[2]*dt;
+            double Rz[3][3] = {{cos(th), -sin(th), 0}, {sin(th), cos(th), 0}, {0, 0, 1}};
+            double Rz_t[3][3], C_teme2ecef[3][3], C_e2t[3][3];
+            mat3_transpose(Rz, Rz_t);
+            mat3_mult(Rz_t, C_teme2ecef0, C_teme2ecef);
+            mat3_transpose(C_teme2ecef, C_e2t);
+            double p_ecef[3], v_ecef[3], wxp[3];
+            mat3_vec(C_teme2ecef, &xs[0], p_ecef);
+            mat3_vec(C_teme2ecef, &xs[3], v_ecef);
+            vec3_cross(omegaearth, p_ecef, wxp);
+            for (int i=0; i<3; i++)
+                v_ecef[i] = v_ecef[i] - wxp[i];
+            double r_ecef = sqrt(vec3_dot(p_ecef,p_ecef));
+            double LLA[4];
+            LLA[0] = asin(p_ecef[2]/r_ecef);
+            LLA[1] = LLA[0];
+            LLA[2] = atan2(p_ecef[1], p_ecef[0]);
+            LLA[3] = (r_ecef - 6378137)/1000.0;
+            
+            // Full model
+            double B[3], B_dot[3];
+            magnet_coef_update(&mc_node, t2000utc + dt, magnetic_model, G, H, G_wmm, H_wmm);
+            magnet_field(p_ecef, v_ecef, LLA, C_e2t, &mc_node, l_max, B, B_dot);
+            for (int i=0; i<3; i++){
+                y_node[k][i] = xs[i];
+                y_node[k][i+3] = B[i];
+                y_node[k][i+6] = B_dot[i];
+            }
+        }
+        cheb_fit(MAGNET_ARC_NPTS, x_node, 9, y_node, MAGNET_ARC_NCOEF, ma->coef);
+        ma->valid = 1;
+        ma->n_fits++;
+        
+        x = 2*(t2000utc - ma->t0)/(ma->t1 - ma->t0) - 1;
+        cheb_series(MAGNET_ARC_NCOEF, 9, (const double (*)[MAGNET_ARC_NCOEF]) ma->coef, x, f, NULL);
+    }
+    
+    for (int i=0; i<3; i++){
+        B_field_i[i] = f[i+3];
+        B_field_i_dot[i] = f[i+6];
+    }
+    
+}
@@ -0,0 +1,66 @@
+//
+//  magnet_field_arc.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        magnet_field_arc.c
+//%
+//% DESCRIPTION:          This function will calculate the magnetic field
+//%                       vector and its time derivative at the satellite
+//%                       position from an along-track Chebyshev fit. At the
+//%                       start of an arc (1/MAGNET_ARC_SPLIT of the orbital
+//%                       period), the trajectory is predicted from the
+//%                       current state (two-body and J2, Earth rotating at
+//%                       constant rate), the magnetic model is evaluated
+//%                       at MAGNET_ARC_NPTS Chebyshev nodes and the field
+//%                       and its derivative in inertial frame are fitted.
+//%                       A new arc is fitted when the time leaves the arc
+//%                       or the position is more than MAGNET_ARC_DRIFT
+//%                       from the predicted one
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct magnet_arc *ma: along-track fit
+//%                       struct magnet_coef *mc: magnetic potential
+//%                         coefficient cache (set at t2000utc when an arc
+//%                         is fitted; the nodes use a local copy)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double p[3]: position in TEME frame (m)
+//%                       double v[3]: velocity in TEME frame (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
+//%                       int magnetic_model: 1 for IGRF-12, 2 for WMM
+//%                       int l_max: maximum degree in spherical harmonic
+//%                         expansion
+//%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
+//%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
+//%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
+//%
+//% OUTPUT:               double B_field_i[3]: magnetic field vector in inertial frame
+//%                       double B_field_i_dot[3]: time derivative of magnetic field
+//%                         vector in inertial frame as seen from orbiting
+//%                         spacecraft
+//%
+//% COUPLING:             - cheb_fit.c
+//%                       - cheb_series.c
+//%                       - linalg.h
+//%                       - magnet_coef_update.c
+//%                       - magnet_field.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef magnet_field_arc_h
+#define magnet_field_arc_h
+
+#include <stdio.h>
+#include "magnet_arc.h"
+#include "magnet_coef.h"
+
+void magnet_field_arc(struct magnet_arc *ma, struct magnet_coef *mc, double t2000utc, double p[3], double v[3], double C_ecef2teme[3][3], int magnetic_model, int l_max, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double B_field_i[3], double B_field_i_dot[3]);
+
+#endif /* magnet_field_arc_h */
@@ -33,10 +33,22 @@
 #include "quatnormalize.h"
 #include "sc_parameters.h"
 #include "sc_geometry.h"
+#include "load_facets.h"
+#include "facet_table_build.h"
+#include "facet_bvh_build.h"
 #include "load_inputs.h"
+#include "load_model_parameters.h"
+#include "load_space_weather.h"
+#include "load_density_table.h"
+#include "unload_density_table.h"
+#include "unload_cheb_ephemeris.h"
+#include "gate_models.h"
+#include "load_hwm14.h"
+#include "load_time_scales.h"
 #include "norm_coef.h"
 #include "gaus_coef.h"
 #include "gaus_coef_wmm.h"
+#include "sph_schmidt.h"
 #include "load_teme.h"
 #include "check_inputs.h"
 #include "teme2ecef.h"
@@ -46,11 +58,6 @@
 #include "tt2utc.h"
 #include "t2doy.h"
 #include "dotprod.h"
-#include "moon.h"
-#include "sun.h"
-#include "grav_potential.h"
-#include "sun_potential.h"
-#include "moon_potential.h"
 
 int main()
 {
@@ -65,16 +72,62 @@ int main()
     ////////////////////////////////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////////////////////
     
+    // Load model parameters
+    double model_parameters[N_MODEL_PARAMETERS];
+    load_model_parameters(model_parameters);
+    
     // Check length of input files
     int length_of_file[5];
-    check_inputs(length_of_file);
+    check_inputs(length_of_file, model_parameters);
     
     // Load input files
-    double time_parameters[13], spacecraft_parameters[33], grav_coef[5148][6], mag_coef[195][27], model_parameters[27], ap_index[length_of_file[0]], solar_input[length_of_file[1]][3], wmm_coef[90][18], iar80[106][5], rar80[106][4], eop[length_of_file[2]][10], max_dates[5][3], sun_eph[length_of_file[3]][3], moon_eph[length_of_file[4]][3], albedo[12][20][40][2];
-    load_inputs(length_of_file, time_parameters, spacecraft_parameters, grav_coef, mag_coef, model_parameters, ap_index, solar_input, wmm_coef, iar80, rar80, eop, max_dates, sun_eph, moon_eph, albedo);
+    double time_parameters[13], spacecraft_parameters[33], grav_coef[5148][6], mag_coef[195][27], ap_index[length_of_file[0]], solar_input[length_of_file[1]][3], wmm_coef[90][18], iar80[106][5], rar80[106][4], eop[length_of_file[2]][10], max_dates[5][3], sun_eph[length_of_file[3]][3], moon_eph[length_of_file[4]][3], albedo[12][20][40][2];
+    struct cheb_ephemeris eph_cheb[2];
+    load_inputs(length_of_file, time_parameters, spacecraft_parameters, grav_coef, mag_coef, model_parameters, ap_index, solar_input, wmm_coef, iar80, rar80, eop, max_dates, sun_eph, moon_eph, eph_cheb, albedo);
+    
+    // Build space-weather store
+    struct space_weather sw;
+    load_space_weather(length_of_file, ap_index, solar_input, model_parameters[19], &sw);
+    
+    // Along-track density cache (disabled if the maximum window is 0)
+    struct density_cache dc = {.window_max = model_parameters[28], .tol = model_parameters[29], .window = 0};
+    
+    // JB2008 inputs of the current epoch (shared by all stages)
+    struct jb2008_cache jc = {.valid = 0};
+    
+    // Precomputed density table (memory-mapped, see 'make density_table')
+    struct density_table dtab = {.map = NULL};
+    if (model_parameters[30]==1)
+        load_density_table("data/density_table.bin", model_parameters[17], model_parameters[18], &dtab);
+    
+    // Automatic model gating (disabled if the tolerance is 0)
+    struct model_gating mg = {.tol = model_parameters[31], .recheck = model_parameters[32], .alt_max = model_parameters[33]};
+    
+    // Along-track HWM14 wind cache (disabled if the sampling interval is 0)
+    struct wind_cache wc = {.cadence = model_parameters[34]};
+    
+    // Native HWM14 coefficients
+    struct hwm14_model hwm = {.nbf = 0};
+    if (model_parameters[21]==2)
+        load_hwm14(&hwm);
+    
+    // Magnetic potential coefficients (set per day, shared by all stages)
+    // and Schmidt semi-normalization factors (set once)
+    struct magnet_coef mc = {.valid = 0};
+    sph_schmidt(mc.S);
+    
+    // Along-track fit of the magnetic field (magnetic fidelity 3)
+    struct magnet_arc ma = {.valid = 0};
+    
+    // Leap second table and time scales of the current epoch
+    struct time_scales ts;
+    load_time_scales(&ts);
+    
+    // TEME/ECEF rotation of the current epoch
+    struct frame_cache fc = {.valid = 0};
     
     // Load TLE output (r and v in TEME frame) and set initial orbital elements in (TEME frame)
-    load_teme(eop, spacecraft_parameters, time_parameters, model_parameters, max_dates);
+    load_teme(length_of_file[2], eop, &ts, spacecraft_parameters, time_parameters, model_parameters, max_dates);
     
     // Normalize coefficients of gravitational and magnetic potentials to correct units
     double C[101][101], S[101][101], G[14][14][25], H[14][14][25], G_wmm[13][13][8], H_wmm[13][13][8];
@@ -96,6 +149,15 @@ int main()
     n_surf = spacecraft_parameters[1];  // Number of surfaces in geometry
     struct surface geometry[n_surf];
     double total_surface = sc_geometry(n_surf, geometry);
+    struct facets fa;
+    load_facets(n_surf, geometry, &fa);
+    struct facet_bvh bvh;
+    if (model_parameters[39]>0){
+        facet_bvh_build(n_surf, geometry, (int) model_parameters[39], (int) model_parameters[40], &bvh);
+        fa.bvh = &bvh;
+    }
+    struct facet_table ft;
+    facet_table_build(&fa, (int) model_parameters[38], &ft);
     
     // Initialize state and orbital parameters. Output to screen.
     orbital2state(p,v,coe);
@@ -296,7 +358,7 @@ int main()
     // This is done by first converting TEME to ECEF considering polar motion and sidereal time and then by converting from ECEF to J2000
     
     double t2000utc;
-    t2000utc = tt2utc(t2000tt); // convert terrestrial time to UTC time
+    t2000utc = tt2utc(t2000tt, &ts); // convert terrestrial time to UTC time
     double ttt = (t2000tt-(12*60*60.0))/(60*60*24*36525.0);   // julian centuries of TT
     // Day of Year UTC
     int timev[3];
@@ -344,6 +406,14 @@ int main()
     double W_sun = 0;
     double W_moon = 0;
     
+    // Potential energies (Earth, Sun, Moon) from first and last integrator stages
+    double U1[3], U_stage[3], U7[3];
+    for (int i=0; i<3; i++){
+        U1[i] = 0;
+        U_stage[i] = 0;
+        U7[i] = 0;
+    }
+    
     ////////////////////////////////////////////////////////////////////////////////////////////
     ////////////////////////////////////////////////////////////////////////////////////////////
     
@@ -369,49 +439,49 @@ int main()
             fprintf(f_param,"%f\t%.16e\t%.16e\t%.16e\t%.16e\t%.16e\t%.16e\t",time_current,Wf,Wt,W_gg,W_e,W_sun,W_moon);
         
         /* INTEGRATE */
-        propagation(t2000tt, x, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx1, xd, dxd1);
+        propagation(t2000tt, x, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U1, dx1, xd, dxd1);
         for (int j = 0; j<13; j++)
             x2[j] = x[j]+dt*A[0][0]*dx1[j];
         if (in_kane){
             for (int j = 0; j<7; j++)
                 xd2[j] = xd[j]+dt*A[0][0]*dxd1[j];
         }
-        propagation(t2000tt, x2, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx2, xd2, dxd2);
+        propagation(t2000tt, x2, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U_stage, dx2, xd2, dxd2);
         for (int j = 0; j<13; j++)
             x3[j] = x[j]+dt*(A[0][1]*dx1[j]+A[1][1]*dx2[j]);
         if (in_kane){
             for (int j = 0; j<7; j++)
                 xd3[j] = xd[j]+dt*(A[0][1]*dxd1[j]+A[1][1]*dxd2[j]);
         }
-        propagation(t2000tt, x3, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx3, xd3, dxd3);
+        propagation(t2000tt, x3, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U_stage, dx3, xd3, dxd3);
         for (int j = 0; j<13; j++)
             x4[j] = x[j]+dt*(A[0][2]*dx1[j]+A[1][2]*dx2[j]+A[2][2]*dx3[j]);
         if (in_kane){
             for (int j = 0; j<7; j++)
                 xd4[j] = xd[j]+dt*(A[0][2]*dxd1[j]+A[1][2]*dxd2[j]+A[2][2]*dxd3[j]);
         }
-        propagation(t2000tt, x4, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx4, xd4, dxd4);
+        propagation(t2000tt, x4, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U_stage, dx4, xd4, dxd4);
         for (int j = 0; j<13; j++)
             x5[j] = x[j]+dt*(A[0][3]*dx1[j]+A[1][3]*dx2[j]+A[2][3]*dx3[j]+A[3][3]*dx4[j]);
         if (in_kane){
             for (int j = 0; j<7; j++)
                 xd5[j] = xd[j]+dt*(A[0][3]*dxd1[j]+A[1][3]*dxd2[j]+A[2][3]*dxd3[j]+A[3][3]*dxd4[j]);
         }
-        propagation(t2000tt, x5, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx5, xd5, dxd5);
+        propagation(t2000tt, x5, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U_stage, dx5, xd5, dxd5);
         for (int j = 0; j<13; j++)
             x6[j] = x[j]+dt*(A[0][4]*dx1[j]+A[1][4]*dx2[j]+A[2][4]*dx3[j]+A[3][4]*dx4[j]+A[4][4]*dx5[j]);
         if (in_kane){
             for (int j = 0; j<7; j++)
                 xd6[j] = xd[j]+dt*(A[0][4]*dxd1[j]+A[1][4]*dxd2[j]+A[2][4]*dxd3[j]+A[3][4]*dxd4[j]+A[4][4]*dxd5[j]);
         }
-        propagation(t2000tt, x6, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx6, xd6, dxd6);
+        propagation(t2000tt, x6, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U_stage, dx6, xd6, dxd6);
         for (int j = 0; j<13; j++)
             x7[j] = x[j]+dt*(A[0][5]*dx1[j]+A[1][5]*dx2[j]+A[2][5]*dx3[j]+A[3][5]*dx4[j]+A[4][5]*dx5[j]+A[5][5]*dx6[j]);
         if(in_kane){
             for (int j = 0; j<7; j++)
                 xd7[j] = xd[j]+dt*(A[0][5]*dxd1[j]+A[1][5]*dxd2[j]+A[2][5]*dxd3[j]+A[3][5]*dxd4[j]+A[4][5]*dxd5[j]+A[5][5]*dxd6[j]);
         }
-        propagation(t2000tt, x7, Inertia, I_inv, M, m, n_surf, geometry, C, S, length_of_file, ap_index, solar_input, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, albedo, f, g, fg_i, dx7, xd7, dxd7);
+        propagation(t2000tt, x7, Inertia, I_inv, M, m, &fa, &ft, C, S, length_of_file, &sw, &dc, &jc, &dtab, &mg, &wc, &hwm, &mc, &ma, &ts, &fc, G, H, G_wmm, H_wmm, model_parameters, eop, sun_eph, moon_eph, eph_cheb, albedo, f, g, fg_i, U7, dx7, xd7, dxd7);
         for (int j = 0; j<13; j++)
             x[j] = x[j] + dt*(B[0]*dx1[j]+B[1]*dx2[j]+B[2]*dx3[j]+B[3]*dx4[j]+B[4]*dx5[j]+B[5]*dx6[j]+B[6]*dx7[j]);
         if (in_kane){
@@ -459,34 +529,14 @@ int main()
             
         }
         
+        // Models evaluated during the next step
+        if (mg.tol>0)
+            gate_models(&mg, time_current+dt, x, fg_i, model_parameters);
+        
         /* PRINT ENERGY TO WORK FILE */
-        if ((n_step % (int)(output_step/dt) == 0)&&(in_work)){
-            
-            // Calculate Gravitational Potential Energy
-            double U = 0;
-            if (model_parameters[2]==1){
-                int l_max_a = model_parameters[14];
-                U = grav_potential(t2000tt, p, v, m, C, S, l_max_a);
-            }
-            
-            // Sun Potential Energy
-            double U_sun = 0;
-            if (model_parameters[5]==1){
-                double r_sun[3];
-                sun(t2000tt, length_of_file, sun_eph, r_sun);
-                U_sun = sun_potential(p,m,r_sun);
-            }
-            
-            // Moon Potential Energy
-            double U_moon = 0;
-            if (model_parameters[6]==1){
-                double r_moon[3];
-                moon(t2000tt, length_of_file, moon_eph, r_moon);
-                U_moon = moon_potential(p,m,r_moon);
-            }
-            
-            fprintf(f_param,"%.16e\t%.16e\t%.16e\n",U,U_sun,U_moon);
-        }
+        // First integrator stage was evaluated at the current state and time
+        if ((n_step % (int)(output_step/dt) == 0)&&(in_work))
+            fprintf(f_param,"%.16e\t%.16e\t%.16e\n",U1[0],U1[1],U1[2]);
         
         /* PRINT PERTURBATIONS TO PERTURBATIONS FILE */
         if ((n_step % (int)(output_step/dt) == 0)&&(in_pert)){
@@ -549,30 +599,38 @@ int main()
         
         fprintf(f_param,"%f\t%.16e\t%.16e\t%.16e\t%.16e\t%.16e\t%.16e\t",time_current,Wf,Wt,W_gg,W_e,W_sun,W_moon);
         
-        // Calculate Potential Energy
-        double U = 0;
-        if (model_parameters[2]==1){
-            int l_max_a = model_parameters[14];
-            U = grav_potential(t2000tt, p, v, m, C, S, l_max_a);
-        }
-        
-        // Sun Potential Energy
-        double U_sun = 0;
-        if (model_parameters[5]==1){
-            double r_sun[3];
-            sun(t2000tt, length_of_file, sun_eph, r_sun);
-            U_sun = sun_potential(p,m,r_sun);
-        }
-        
-        // Moon Potential Energy
-        double U_moon = 0;
-        if (model_parameters[6]==1){
-            double r_moon[3];
-            moon(t2000tt, length_of_file, moon_eph, r_moon);
-            U_moon = moon_potential(p,m,r_moon);
-        }
-        
-        fprintf(f_param,"%.16e\t%.16e\t%.16e\n",U,U_sun,U_moon);
+        // Potential Energy from last integrator stage (evaluated at the final state)
+        fprintf(f_param,"%.16e\t%.16e\t%.16e\n",U7[0],U7[1],U7[2]);
+    }
+    
+    // Unmap the density table and the Chebyshev ephemerides
+    unload_density_table(&dtab);
+    unload_cheb_ephemeris(&eph_cheb[0]);
+    unload_cheb_ephemeris(&eph_cheb[1]);
+    
+    // Density cache statistics
+    if (dc.window_max>0){
+        printf("Density cache: %ld calls, %.1f%% served by the fit, %ld checks, relative error max %.2e mean %.2e\n", dc.n_calls, (dc.n_calls>0) ? 100.0*dc.n_hits/dc.n_calls : 0.0, dc.n_checks, dc.err_max, (dc.n_checks>0) ? dc.err_sum/dc.n_checks : 0.0);
+    }
+    
+    // Wind cache statistics
+    if (wc.cadence>0){
+        printf("Wind cache: %ld calls, %ld HWM14 samples\n", wc.n_calls, wc.n_samples);
+    }
+    
+    // Magnetic field fit statistics
+    if (model_parameters[35]==3){
+        printf("Magnetic field fit: %ld calls, %ld arcs (%ld for trajectory drift)\n", ma.n_calls, ma.n_fits, ma.n_drift);
+    }
+    
+    // Model gating statistics
+    if (mg.tol>0){
+        printf("Model gating: %ld switches\n", mg.n_switch);
+    }
+    
+    // Self-shadowing statistics
+    if (fa.bvh != NULL){
+        printf("Self-shadowing: %ld calls, %ld rays\n", bvh.n_calls, bvh.n_rays);
     }
     
     // Output orbital parameters to screen
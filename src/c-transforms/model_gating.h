@@ -0,0 +1,74 @@
+//
+//  model_gating.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        model_gating.h
+//%
+//% DESCRIPTION:          This structure contains the automatic model gating
+//%                       state updated by gate_models.c after each step and
+//%                       used by propagation.c: which models are skipped,
+//%                       the gravity degree used for the acceleration and
+//%                       the running estimates of each model's magnitude
+//%                       relative to the total
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           double model_gating.tol: relative tolerance, 0 to
+//%                         disable gating
+//%                       int model_gating.recheck: steps between
+//%                         re-evaluations of skipped models
+//%                       double model_gating.alt_max: maximum altitude for
+//%                         aerodynamics (km)
+//%                       int model_gating.off_aero, off_wind, off_alb,
+//%                         off_ir: 0 if the aerodynamic (drag and torque),
+//%                         HWM14 wind, albedo and IR models are evaluated, 1
+//%                         if skipped for their magnitude, 2 if skipped for
+//%                         the altitude (aerodynamics only)
+//%                       int model_gating.l_max_a: maximum degree used for
+//%                         the gravity acceleration (0 if not limited)
+//%                       int model_gating.probe: 1 if the models skipped
+//%                         for their magnitude are evaluated this step
+//%                       long model_gating.n_step: number of steps
+//%                       double model_gating.est[4]: running estimates of
+//%                         the aerodynamic, wind, albedo and IR magnitudes
+//%                         relative to the total acceleration or torque
+//%                       double model_gating.h_aero: altitude of the last
+//%                         aerodynamic estimate (km)
+//%                       long model_gating.n_switch: number of switches
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef model_gating_h
+#define model_gating_h
+
+struct model_gating
+{
+    // Settings
+    double tol;
+    int recheck;
+    double alt_max;
+    
+    // Decisions
+    int off_aero;
+    int off_wind;
+    int off_alb;
+    int off_ir;
+    int l_max_a;
+    int probe;
+    
+    // Running estimates
+    long n_step;
+    double est[4];
+    double h_aero;
+    
+    // Statistics
+    long n_switch;
+};
+
+#endif /* model_gating_h */
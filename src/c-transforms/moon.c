@@ -15,38 +15,64 @@
 //% VERSION:              1
 //%
 //% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eph_model: 1 for tabulated ephemeris (linear
+//%                         interpolation); 2 for Chebyshev ephemeris; 3 for
+//%                         analytical series
 //%                       int length_of_file[5]: array with lengths of files
 //%                       double moon_eph[length_of_file[4]][3]: moon ephemerides
+//%                       const struct cheb_ephemeris *moon_cheb: Chebyshev
+//%                         ephemeris of the Moon
 //%
 //% OUTPUT:               double r_moon[3]: position of Moon in inertial frame
 //%                         (MOD, assumed to be equal to initial TEME) (m)
 //%                       double r: distance from Earth to Moon (m)
 //%
 //% COUPLING:             - norm.c
+//%                       - cheb_eval.c
+//%                       - moon_analytic.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "moon.h"
 #include <math.h>
 #include "norm.h"
+#include "cheb_eval.h"
+#include "moon_analytic.h"
 
-double moon(double t2000tt, int length_of_file[5], double moon_eph[length_of_file[4]][3], double r_moon[3]){
+double moon(double t2000tt, int eph_model, int length_of_file[5], double moon_eph[length_of_file[4]][3], const struct cheb_ephemeris *moon_cheb, double r_moon[3]){
     
     // Constants
     double au = 149597870700;
     
-    int xx = t2000tt/(4*60*60);
-    double xrem = fmod(t2000tt,4*60*60.0);
-    
-    double r0[3], r1[3];
-    for (int i=0; i<3; i++){
-        r0[i] = moon_eph[xx][i];
-        r1[i] = moon_eph[xx+1][i];
+    if (eph_model == 2){
+        
+        // Chebyshev ephemeris
+        cheb_eval(moon_cheb, t2000tt, r_moon, NULL);
+        
+    }
+    else if (eph_model == 3){
+        
+        // Analytical ephemeris
+        moon_analytic(t2000tt, r_moon);
+        
     }
+    else{
+        
+        // Tabulated ephemeris
+        int xx = t2000tt/(4*60*60);
+        double xrem = fmod(t2000tt,4*60*60.0);
     
-    // Moon position vector
-    for (int i=0; i<3; i++)
-    r_moon[i] = ((r1[i]-r0[i])*xrem/(4*60*60.0) + r0[i])*au;
+        double r0[3], r1[3];
+        for (int i=0; i<3; i++){
+            r0[i] = moon_eph[xx][i];
+            r1[i] = moon_eph[xx+1][i];
+        }
+    
+        // Moon position vector
+        for (int i=0; i<3; i++)
+            r_moon[i] = ((r1[i]-r0[i])*xrem/(4*60*60.0) + r0[i])*au;
+        
+    }
     
     // Earth - Moon distance
     double r = norm(r_moon);
@@ -15,14 +15,21 @@
 //% VERSION:              1
 //%
 //% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eph_model: 1 for tabulated ephemeris (linear
+//%                         interpolation); 2 for Chebyshev ephemeris; 3 for
+//%                         analytical series
 //%                       int length_of_file[5]: array with lengths of files
 //%                       double moon_eph[length_of_file[4]][3]: moon ephemerides
+//%                       const struct cheb_ephemeris *moon_cheb: Chebyshev
+//%                         ephemeris of the Moon
 //%
 //% OUTPUT:               double r_moon[3]: position of Moon in inertial frame
 //%                         (MOD, assumed to be equal to initial TEME) (m)
 //%                       double r: distance from Earth to Moon (m)
 //%
 //% COUPLING:             - norm.c
+//%                       - cheb_eval.c
+//%                       - moon_analytic.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -30,7 +37,8 @@
 #define moon_h
 
 #include <stdio.h>
+#include "cheb_ephemeris.h"
 
-double moon(double t2000tt, int length_of_file[5], double moon_eph[length_of_file[4]][3], double r_moon[3]);
+double moon(double t2000tt, int eph_model, int length_of_file[5], double moon_eph[length_of_file[4]][3], const struct cheb_ephemeris *moon_cheb, double r_moon[3]);
 
 #endif /* moon_h */
@@ -0,0 +1,77 @@
+//
+//  moon_analytic.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        moon_analytic.c
+//%
+//% DESCRIPTION:          This function calculates a low-precision position
+//%                       of the Moon from an analytical series (Montenbruck &
+//%                       Gill (2000) Satellite Orbits, Section 3.3.2).
+//%                       Accuracy is a few arcminutes in direction and
+//%                       ~500 km in distance and no ephemeris file is needed
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r_moon[3]: position of Moon in inertial frame
+//%                         (mean equator and equinox of date) (m)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "moon_analytic.h"
+#include <math.h>
+
+void moon_analytic(double t2000tt, double r_moon[3]){
+    
+    // Constants
+    double deg = M_PI/180.0;
+    double arcsec = deg/3600.0;
+    
+    // Julian centuries (TT) since J2000.0
+    double T = (t2000tt - 12*60*60.0)/(36525*24*60*60.0);
+    
+    // Mean arguments (mean equinox of date)
+    double L0 = (218.31617 + 481267.88088*T)*deg; // mean longitude of the Moon
+    double l  = (134.96292 + 477198.86753*T)*deg; // mean anomaly of the Moon
+    double lp = (357.52543 + 35999.04944*T)*deg;  // mean anomaly of the Sun
+    double F  = (93.27283 + 483202.01873*T)*deg;  // mean argument of latitude
+    double D  = (297.85027 + 445267.11135*T)*deg; // mean elongation from the Sun
+    
+    // Ecliptic longitude
+    double lambda = L0 + (22640*sin(l) + 769*sin(2*l) - 4586*sin(l-2*D) + 2370*sin(2*D)
+                          - 668*sin(lp) - 412*sin(2*F) - 212*sin(2*l-2*D) - 206*sin(l+lp-2*D)
+                          + 192*sin(l+2*D) - 165*sin(lp-2*D) + 148*sin(l-lp) - 125*sin(D)
+                          - 110*sin(l+lp) - 55*sin(2*F-2*D))*arcsec;
+    
+    // Ecliptic latitude
+    double beta = (18520*sin(F + lambda - L0 + (412*sin(2*F) + 541*sin(lp))*arcsec)
+                   - 526*sin(F-2*D) + 44*sin(l+F-2*D) - 31*sin(-l+F-2*D) - 25*sin(-2*l+F)
+                   - 23*sin(lp+F-2*D) + 21*sin(-l+F) + 11*sin(-lp+F-2*D))*arcsec;
+    
+    // Distance
+    double r = (385000 - 20905*cos(l) - 3699*cos(2*D-l) - 2956*cos(2*D) - 570*cos(2*l)
+                + 246*cos(2*l-2*D) - 205*cos(lp-2*D) - 171*cos(l+2*D) - 152*cos(l+lp-2*D))*1000;
+    
+    // Mean obliquity of the ecliptic
+    double eps = 23.43929111*deg - 46.8150*T*arcsec;
+    
+    // Ecliptic position
+    double x = r*cos(lambda)*cos(beta);
+    double y = r*sin(lambda)*cos(beta);
+    double z = r*sin(beta);
+    
+    // Equatorial position
+    r_moon[0] = x;
+    r_moon[1] = y*cos(eps) - z*sin(eps);
+    r_moon[2] = y*sin(eps) + z*cos(eps);
+    
+}
@@ -0,0 +1,37 @@
+//
+//  moon_analytic.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        moon_analytic.c
+//%
+//% DESCRIPTION:          This function calculates a low-precision position
+//%                       of the Moon from an analytical series (Montenbruck &
+//%                       Gill (2000) Satellite Orbits, Section 3.3.2).
+//%                       Accuracy is a few arcminutes in direction and
+//%                       ~500 km in distance and no ephemeris file is needed
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r_moon[3]: position of Moon in inertial frame
+//%                         (mean equator and equinox of date) (m)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef moon_analytic_h
+#define moon_analytic_h
+
+#include <stdio.h>
+
+void moon_analytic(double t2000tt, double r_moon[3]);
+
+#endif /* moon_analytic_h */
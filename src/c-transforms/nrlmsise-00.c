@@ -67,12 +67,33 @@ extern double pavgm[10];
 
 /* LPOLY */
 static double dfa;
-static double plg[4][9];
-static double ctloc, stloc;
-static double c2tloc, s2tloc;
-static double s3tloc, c3tloc;
 static double apdf, apt[4];
 
+/* POSITION TERMS OF G(L) */
+struct globe7_point {
+	double plg[4][9];
+	double ctloc, stloc;
+	double c2tloc, s2tloc;
+	double s3tloc, c3tloc;
+	double clong, slong;
+};
+
+/* EPOCH TERMS OF G(L), for one parameter set */
+struct globe7_epoch {
+	double cd32, cd18, cd14, cd39;
+	double t0, f1, f2;
+	double apdf;
+	double cut71, cut58, cut75;
+};
+
+/* EPOCH TERMS OF GTS7, for each of its parameter sets */
+struct gts7_epoch {
+	struct globe7_epoch pt, ps, pd[9];
+};
+
+/* GTD7_RHO_BATCH: points per block of position terms */
+#define GTD7_BATCH 64
+
 
 
 /* ------------------------------------------------------------------- */
@@ -597,27 +618,16 @@ __inline_double sg0(double ex, double *p, double *ap) {
                 g0(ap[6],p)*pow(ex,12.0))*(1.0-pow(ex,8.0))/(1.0-ex)))/sumex(ex);
 }
 
-double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
-/*       CALCULATE G(L) FUNCTION 
- *       Upper Thermosphere Parameters */
-	double t[15];
-	int i,j;
-	double apd;
+static void globe7_plg(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct globe7_point *g) {
+/*       LEGENDRE POLYNOMIALS AND LOCAL TIME HARMONICS OF G(L)
+ *       Depend only on position and local time, shared by all calls of
+ *       globe7_eval (and glob7s) for the same point */
 	double tloc;
 	double c, s, c2, c4, s2;
-	double sr = 7.2722E-5;
 	double dgtr = 1.74533E-2;
-	double dr = 1.72142E-2;
 	double hr = 0.2618;
-	double cd32, cd18, cd14, cd39;
-	double df;
-	double f1, f2;
-	double tinf;
-	struct ap_array *ap;
 
 	tloc=input->lst;
-	for (j=0;j<14;j++)
-		t[j]=0;
 
 	/* calculate legendre polynomials */
 	c = sin(input->g_lat * dgtr);
@@ -626,90 +636,157 @@ double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 	c4 = c2*c2;
 	s2 = s*s;
 
-	plg[0][1] = c;
-	plg[0][2] = 0.5*(3.0*c2 -1.0);
-	plg[0][3] = 0.5*(5.0*c*c2-3.0*c);
-	plg[0][4] = (35.0*c4 - 30.0*c2 + 3.0)/8.0;
-	plg[0][5] = (63.0*c2*c2*c - 70.0*c2*c + 15.0*c)/8.0;
-	plg[0][6] = (11.0*c*plg[0][5] - 5.0*plg[0][4])/6.0;
-/*      plg[0][7] = (13.0*c*plg[0][6] - 6.0*plg[0][5])/7.0; */
-	plg[1][1] = s;
-	plg[1][2] = 3.0*c*s;
-	plg[1][3] = 1.5*(5.0*c2-1.0)*s;
-	plg[1][4] = 2.5*(7.0*c2*c-3.0*c)*s;
-	plg[1][5] = 1.875*(21.0*c4 - 14.0*c2 +1.0)*s;
-	plg[1][6] = (11.0*c*plg[1][5]-6.0*plg[1][4])/5.0;
-/*      plg[1][7] = (13.0*c*plg[1][6]-7.0*plg[1][5])/6.0; */
-/*      plg[1][8] = (15.0*c*plg[1][7]-8.0*plg[1][6])/7.0; */
-	plg[2][2] = 3.0*s2;
-	plg[2][3] = 15.0*s2*c;
-	plg[2][4] = 7.5*(7.0*c2 -1.0)*s2;
-	plg[2][5] = 3.0*c*plg[2][4]-2.0*plg[2][3];
-	plg[2][6] =(11.0*c*plg[2][5]-7.0*plg[2][4])/4.0;
-	plg[2][7] =(13.0*c*plg[2][6]-8.0*plg[2][5])/5.0;
-	plg[3][3] = 15.0*s2*s;
-	plg[3][4] = 105.0*s2*s*c; 
-	plg[3][5] =(9.0*c*plg[3][4]-7.*plg[3][3])/2.0;
-	plg[3][6] =(11.0*c*plg[3][5]-8.*plg[3][4])/3.0;
+	g->plg[0][1] = c;
+	g->plg[0][2] = 0.5*(3.0*c2 -1.0);
+	g->plg[0][3] = 0.5*(5.0*c*c2-3.0*c);
+	g->plg[0][4] = (35.0*c4 - 30.0*c2 + 3.0)/8.0;
+	g->plg[0][5] = (63.0*c2*c2*c - 70.0*c2*c + 15.0*c)/8.0;
+	g->plg[0][6] = (11.0*c*g->plg[0][5] - 5.0*g->plg[0][4])/6.0;
+/*      g->plg[0][7] = (13.0*c*g->plg[0][6] - 6.0*g->plg[0][5])/7.0; */
+	g->plg[1][1] = s;
+	g->plg[1][2] = 3.0*c*s;
+	g->plg[1][3] = 1.5*(5.0*c2-1.0)*s;
+	g->plg[1][4] = 2.5*(7.0*c2*c-3.0*c)*s;
+	g->plg[1][5] = 1.875*(21.0*c4 - 14.0*c2 +1.0)*s;
+	g->plg[1][6] = (11.0*c*g->plg[1][5]-6.0*g->plg[1][4])/5.0;
+/*      g->plg[1][7] = (13.0*c*g->plg[1][6]-7.0*g->plg[1][5])/6.0; */
+/*      g->plg[1][8] = (15.0*c*g->plg[1][7]-8.0*g->plg[1][6])/7.0; */
+	g->plg[2][2] = 3.0*s2;
+	g->plg[2][3] = 15.0*s2*c;
+	g->plg[2][4] = 7.5*(7.0*c2 -1.0)*s2;
+	g->plg[2][5] = 3.0*c*g->plg[2][4]-2.0*g->plg[2][3];
+	g->plg[2][6] =(11.0*c*g->plg[2][5]-7.0*g->plg[2][4])/4.0;
+	g->plg[2][7] =(13.0*c*g->plg[2][6]-8.0*g->plg[2][5])/5.0;
+	g->plg[3][3] = 15.0*s2*s;
+	g->plg[3][4] = 105.0*s2*s*c; 
+	g->plg[3][5] =(9.0*c*g->plg[3][4]-7.*g->plg[3][3])/2.0;
+	g->plg[3][6] =(11.0*c*g->plg[3][5]-8.*g->plg[3][4])/3.0;
 
 	if (!(((flags->sw[7]==0)&&(flags->sw[8]==0))&&(flags->sw[14]==0))) {
-		stloc = sin(hr*tloc);
-		ctloc = cos(hr*tloc);
-		s2tloc = sin(2.0*hr*tloc);
-		c2tloc = cos(2.0*hr*tloc);
-		s3tloc = sin(3.0*hr*tloc);
-		c3tloc = cos(3.0*hr*tloc);
+		g->stloc = sin(hr*tloc);
+		g->ctloc = cos(hr*tloc);
+		g->s2tloc = sin(2.0*hr*tloc);
+		g->c2tloc = cos(2.0*hr*tloc);
+		g->s3tloc = sin(3.0*hr*tloc);
+		g->c3tloc = cos(3.0*hr*tloc);
 	}
 
-	cd32 = cos(dr*(input->doy-p[31]));
-	cd18 = cos(2.0*dr*(input->doy-p[17]));
-	cd14 = cos(dr*(input->doy-p[13]));
-	cd39 = cos(2.0*dr*(input->doy-p[38]));
+	/* longitude harmonic of the longitudinal term */
+	g->clong = cos(dgtr*input->g_long);
+	g->slong = sin(dgtr*input->g_long);
+}
+
+static void globe7_epoch_terms(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct globe7_epoch *e) {
+/*       TERMS OF G(L) THAT DEPEND ONLY ON THE EPOCH (doy, sec, F10.7, ap)
+ *       for the parameter set p */
+	double df, dfa, apd, p44, p45;
+	double sr = 7.2722E-5;
+	double dr = 1.72142E-2;
+
+	e->cd32 = cos(dr*(input->doy-p[31]));
+	e->cd18 = cos(2.0*dr*(input->doy-p[17]));
+	e->cd14 = cos(dr*(input->doy-p[13]));
+	e->cd39 = cos(2.0*dr*(input->doy-p[38]));
 
-	/* F10.7 EFFECT */
 	df = input->f107 - input->f107A;
 	dfa = input->f107A - 150.0;
-	t[0] =  p[19]*df*(1.0+p[59]*dfa) + p[20]*df*df + p[21]*dfa + p[29]*pow(dfa,2.0);
-	f1 = 1.0 + (p[47]*dfa +p[19]*df+p[20]*df*df)*flags->swc[1];
-	f2 = 1.0 + (p[49]*dfa+p[19]*df+p[20]*df*df)*flags->swc[1];
+	e->t0 =  p[19]*df*(1.0+p[59]*dfa) + p[20]*df*df + p[21]*dfa + p[29]*pow(dfa,2.0);
+	e->f1 = 1.0 + (p[47]*dfa +p[19]*df+p[20]*df*df)*flags->swc[1];
+	e->f2 = 1.0 + (p[49]*dfa+p[19]*df+p[20]*df*df)*flags->swc[1];
+
+	e->cut71 = cos(sr*(input->sec-p[71]));
+	if (flags->sw[9]==-1) {
+		e->cut58 = cos(sr*(input->sec-p[58]));
+	} else {
+		apd=input->ap-4.0;
+		p44=p[43];
+		p45=p[44];
+		if (p44<0)
+			p44 = 1.0E-5;
+		e->apdf = apd + (p45-1.0)*(apd + (exp(-p44 * apd) - 1.0)/p44);
+		e->cut75 = cos(sr*(input->sec-p[75]));
+	}
+}
+
+static void gts7_epoch_terms(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct gts7_epoch *ep, int all_outputs) {
+/*       EPOCH TERMS OF G(L) FOR THE PARAMETER SETS OF GTS7
+ *       (pd[8] only if all_outputs) */
+	int i;
+
+	globe7_epoch_terms(pt, input, flags, &ep->pt);
+	globe7_epoch_terms(ps, input, flags, &ep->ps);
+	for (i=0;i<(all_outputs ? 9 : 8);i++)
+		globe7_epoch_terms(pd[i], input, flags, &ep->pd[i]);
+}
+
+static double globe7_eval(double *p, struct globe7_epoch *e, struct globe7_point *g, struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
+/*       CALCULATE G(L) FUNCTION FROM THE EPOCH TERMS e OF p AND THE
+ *       POSITION TERMS g
+ *       Upper Thermosphere Parameters */
+	double t[15];
+	int i,j;
+	double tloc;
+	double sr = 7.2722E-5;
+	double dgtr = 1.74533E-2;
+	double hr = 0.2618;
+	double cd32, cd18, cd14, cd39;
+	double f1, f2;
+	double tinf;
+	struct ap_array *ap;
+
+	tloc=input->lst;
+	for (j=0;j<14;j++)
+		t[j]=0;
+
+	/* day of year, F10.7, daily ap and UT terms */
+	cd32 = e->cd32;
+	cd18 = e->cd18;
+	cd14 = e->cd14;
+	cd39 = e->cd39;
+
+	/* F10.7 EFFECT */
+	dfa = input->f107A - 150.0;
+	t[0] = e->t0;
+	f1 = e->f1;
+	f2 = e->f2;
 
 	/*  TIME INDEPENDENT */
-	t[1] = (p[1]*plg[0][2]+ p[2]*plg[0][4]+p[22]*plg[0][6]) + \
-	      (p[14]*plg[0][2])*dfa*flags->swc[1] +p[26]*plg[0][1];
+	t[1] = (p[1]*g->plg[0][2]+ p[2]*g->plg[0][4]+p[22]*g->plg[0][6]) + \
+	      (p[14]*g->plg[0][2])*dfa*flags->swc[1] +p[26]*g->plg[0][1];
 
 	/*  SYMMETRICAL ANNUAL */
 	t[2] = p[18]*cd32;
 
 	/*  SYMMETRICAL SEMIANNUAL */
-	t[3] = (p[15]+p[16]*plg[0][2])*cd18;
+	t[3] = (p[15]+p[16]*g->plg[0][2])*cd18;
 
 	/*  ASYMMETRICAL ANNUAL */
-	t[4] =  f1*(p[9]*plg[0][1]+p[10]*plg[0][3])*cd14;
+	t[4] =  f1*(p[9]*g->plg[0][1]+p[10]*g->plg[0][3])*cd14;
 
 	/*  ASYMMETRICAL SEMIANNUAL */
-	t[5] =    p[37]*plg[0][1]*cd39;
+	t[5] =    p[37]*g->plg[0][1]*cd39;
 
         /* DIURNAL */
 	if (flags->sw[7]) {
 		double t71, t72;
-		t71 = (p[11]*plg[1][2])*cd14*flags->swc[5];
-		t72 = (p[12]*plg[1][2])*cd14*flags->swc[5];
-		t[6] = f2*((p[3]*plg[1][1] + p[4]*plg[1][3] + p[27]*plg[1][5] + t71) * \
-			   ctloc + (p[6]*plg[1][1] + p[7]*plg[1][3] + p[28]*plg[1][5] \
-				    + t72)*stloc);
+		t71 = (p[11]*g->plg[1][2])*cd14*flags->swc[5];
+		t72 = (p[12]*g->plg[1][2])*cd14*flags->swc[5];
+		t[6] = f2*((p[3]*g->plg[1][1] + p[4]*g->plg[1][3] + p[27]*g->plg[1][5] + t71) * \
+			   g->ctloc + (p[6]*g->plg[1][1] + p[7]*g->plg[1][3] + p[28]*g->plg[1][5] \
+				    + t72)*g->stloc);
 }
 
 	/* SEMIDIURNAL */
 	if (flags->sw[8]) {
 		double t81, t82;
-		t81 = (p[23]*plg[2][3]+p[35]*plg[2][5])*cd14*flags->swc[5];
-		t82 = (p[33]*plg[2][3]+p[36]*plg[2][5])*cd14*flags->swc[5];
-		t[7] = f2*((p[5]*plg[2][2]+ p[41]*plg[2][4] + t81)*c2tloc +(p[8]*plg[2][2] + p[42]*plg[2][4] + t82)*s2tloc);
+		t81 = (p[23]*g->plg[2][3]+p[35]*g->plg[2][5])*cd14*flags->swc[5];
+		t82 = (p[33]*g->plg[2][3]+p[36]*g->plg[2][5])*cd14*flags->swc[5];
+		t[7] = f2*((p[5]*g->plg[2][2]+ p[41]*g->plg[2][4] + t81)*g->c2tloc +(p[8]*g->plg[2][2] + p[42]*g->plg[2][4] + t82)*g->s2tloc);
 	}
 
 	/* TERDIURNAL */
 	if (flags->sw[14]) {
-		t[13] = f2 * ((p[39]*plg[3][3]+(p[93]*plg[3][4]+p[46]*plg[3][6])*cd14*flags->swc[5])* s3tloc +(p[40]*plg[3][3]+(p[94]*plg[3][4]+p[48]*plg[3][6])*cd14*flags->swc[5])* c3tloc);
+		t[13] = f2 * ((p[39]*g->plg[3][3]+(p[93]*g->plg[3][4]+p[46]*g->plg[3][6])*cd14*flags->swc[5])* g->s3tloc +(p[40]*g->plg[3][3]+(p[94]*g->plg[3][4]+p[48]*g->plg[3][6])*cd14*flags->swc[5])* g->c3tloc);
 }
 
 	/* magnetic activity based on daily ap */
@@ -728,24 +805,18 @@ double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 			   apt[3]=sg2(exp2,p,ap->a);
 			*/
 			if (flags->sw[9]) {
-				t[8] = apt[0]*(p[50]+p[96]*plg[0][2]+p[54]*plg[0][4]+ \
-     (p[125]*plg[0][1]+p[126]*plg[0][3]+p[127]*plg[0][5])*cd14*flags->swc[5]+ \
-     (p[128]*plg[1][1]+p[129]*plg[1][3]+p[130]*plg[1][5])*flags->swc[7]* \
+				t[8] = apt[0]*(p[50]+p[96]*g->plg[0][2]+p[54]*g->plg[0][4]+ \
+     (p[125]*g->plg[0][1]+p[126]*g->plg[0][3]+p[127]*g->plg[0][5])*cd14*flags->swc[5]+ \
+     (p[128]*g->plg[1][1]+p[129]*g->plg[1][3]+p[130]*g->plg[1][5])*flags->swc[7]* \
 					       cos(hr*(tloc-p[131])));
 			}
 		}
 	} else {
-		double p44, p45;
-		apd=input->ap-4.0;
-		p44=p[43];
-		p45=p[44];
-		if (p44<0)
-			p44 = 1.0E-5;
-		apdf = apd + (p45-1.0)*(apd + (exp(-p44 * apd) - 1.0)/p44);
+		apdf = e->apdf;
 		if (flags->sw[9]) {
-			t[8]=apdf*(p[32]+p[45]*plg[0][2]+p[34]*plg[0][4]+ \
-     (p[100]*plg[0][1]+p[101]*plg[0][3]+p[102]*plg[0][5])*cd14*flags->swc[5]+
-     (p[121]*plg[1][1]+p[122]*plg[1][3]+p[123]*plg[1][5])*flags->swc[7]*
+			t[8]=apdf*(p[32]+p[45]*g->plg[0][2]+p[34]*g->plg[0][4]+ \
+     (p[100]*g->plg[0][1]+p[101]*g->plg[0][3]+p[102]*g->plg[0][5])*cd14*flags->swc[5]+
+     (p[121]*g->plg[1][1]+p[122]*g->plg[1][3]+p[123]*g->plg[1][5])*flags->swc[7]*
 				    cos(hr*(tloc-p[124])));
 		}
 	}
@@ -755,24 +826,24 @@ double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 		/* longitudinal */
 		if (flags->sw[11]) {
 			t[10] = (1.0 + p[80]*dfa*flags->swc[1])* \
-     ((p[64]*plg[1][2]+p[65]*plg[1][4]+p[66]*plg[1][6]\
-      +p[103]*plg[1][1]+p[104]*plg[1][3]+p[105]*plg[1][5]\
-      +flags->swc[5]*(p[109]*plg[1][1]+p[110]*plg[1][3]+p[111]*plg[1][5])*cd14)* \
-          cos(dgtr*input->g_long) \
-      +(p[90]*plg[1][2]+p[91]*plg[1][4]+p[92]*plg[1][6]\
-      +p[106]*plg[1][1]+p[107]*plg[1][3]+p[108]*plg[1][5]\
-      +flags->swc[5]*(p[112]*plg[1][1]+p[113]*plg[1][3]+p[114]*plg[1][5])*cd14)* \
-      sin(dgtr*input->g_long));
+     ((p[64]*g->plg[1][2]+p[65]*g->plg[1][4]+p[66]*g->plg[1][6]\
+      +p[103]*g->plg[1][1]+p[104]*g->plg[1][3]+p[105]*g->plg[1][5]\
+      +flags->swc[5]*(p[109]*g->plg[1][1]+p[110]*g->plg[1][3]+p[111]*g->plg[1][5])*cd14)* \
+          g->clong \
+      +(p[90]*g->plg[1][2]+p[91]*g->plg[1][4]+p[92]*g->plg[1][6]\
+      +p[106]*g->plg[1][1]+p[107]*g->plg[1][3]+p[108]*g->plg[1][5]\
+      +flags->swc[5]*(p[112]*g->plg[1][1]+p[113]*g->plg[1][3]+p[114]*g->plg[1][5])*cd14)* \
+      g->slong);
 		}
 
 		/* ut and mixed ut, longitude */
 		if (flags->sw[12]){
-			t[11]=(1.0+p[95]*plg[0][1])*(1.0+p[81]*dfa*flags->swc[1])*\
-				(1.0+p[119]*plg[0][1]*flags->swc[5]*cd14)*\
-				((p[68]*plg[0][1]+p[69]*plg[0][3]+p[70]*plg[0][5])*\
-				cos(sr*(input->sec-p[71])));
+			t[11]=(1.0+p[95]*g->plg[0][1])*(1.0+p[81]*dfa*flags->swc[1])*\
+				(1.0+p[119]*g->plg[0][1]*flags->swc[5]*cd14)*\
+				((p[68]*g->plg[0][1]+p[69]*g->plg[0][3]+p[70]*g->plg[0][5])*\
+				e->cut71);
 			t[11]+=flags->swc[11]*\
-				(p[76]*plg[2][3]+p[77]*plg[2][5]+p[78]*plg[2][7])*\
+				(p[76]*g->plg[2][3]+p[77]*g->plg[2][5]+p[78]*g->plg[2][7])*\
 				cos(sr*(input->sec-p[79])+2.0*dgtr*input->g_long)*(1.0+p[137]*dfa*flags->swc[1]);
 		}
 
@@ -780,26 +851,26 @@ double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 		if (flags->sw[13]) {
 			if (flags->sw[9]==-1) {
 				if (p[51]) {
-					t[12]=apt[0]*flags->swc[11]*(1.+p[132]*plg[0][1])*\
-						((p[52]*plg[1][2]+p[98]*plg[1][4]+p[67]*plg[1][6])*\
+					t[12]=apt[0]*flags->swc[11]*(1.+p[132]*g->plg[0][1])*\
+						((p[52]*g->plg[1][2]+p[98]*g->plg[1][4]+p[67]*g->plg[1][6])*\
 						 cos(dgtr*(input->g_long-p[97])))\
 						+apt[0]*flags->swc[11]*flags->swc[5]*\
-						(p[133]*plg[1][1]+p[134]*plg[1][3]+p[135]*plg[1][5])*\
+						(p[133]*g->plg[1][1]+p[134]*g->plg[1][3]+p[135]*g->plg[1][5])*\
 						cd14*cos(dgtr*(input->g_long-p[136])) \
 						+apt[0]*flags->swc[12]* \
-						(p[55]*plg[0][1]+p[56]*plg[0][3]+p[57]*plg[0][5])*\
-						cos(sr*(input->sec-p[58]));
+						(p[55]*g->plg[0][1]+p[56]*g->plg[0][3]+p[57]*g->plg[0][5])*\
+						e->cut58;
 				}
 			} else {
-				t[12] = apdf*flags->swc[11]*(1.0+p[120]*plg[0][1])*\
-					((p[60]*plg[1][2]+p[61]*plg[1][4]+p[62]*plg[1][6])*\
+				t[12] = apdf*flags->swc[11]*(1.0+p[120]*g->plg[0][1])*\
+					((p[60]*g->plg[1][2]+p[61]*g->plg[1][4]+p[62]*g->plg[1][6])*\
 					cos(dgtr*(input->g_long-p[63])))\
 					+apdf*flags->swc[11]*flags->swc[5]* \
-					(p[115]*plg[1][1]+p[116]*plg[1][3]+p[117]*plg[1][5])* \
+					(p[115]*g->plg[1][1]+p[116]*g->plg[1][3]+p[117]*g->plg[1][5])* \
 					cd14*cos(dgtr*(input->g_long-p[118])) \
 					+ apdf*flags->swc[12]* \
-					(p[83]*plg[0][1]+p[84]*plg[0][3]+p[85]*plg[0][5])* \
-					cos(sr*(input->sec-p[75]));
+					(p[83]*g->plg[0][1]+p[84]*g->plg[0][3]+p[85]*g->plg[0][5])* \
+					e->cut75;
 			}			
 		}
 	}
@@ -811,14 +882,26 @@ double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 	return tinf;
 }
 
+double globe7(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
+/*       CALCULATE G(L) FUNCTION 
+ *       Upper Thermosphere Parameters */
+	struct globe7_epoch e;
+	struct globe7_point g;
+
+	globe7_epoch_terms(p, input, flags, &e);
+	globe7_plg(input, flags, &g);
+	return globe7_eval(p, &e, &g, input, flags);
+}
+
 
 
 /* ------------------------------------------------------------------- */
 /* ------------------------------- GLOB7S ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-double glob7s(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
+double glob7s(double *p, struct globe7_point *g, struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
 /*    VERSION OF GLOBE FOR LOWER ATMOSPHERE 10/26/99 
+ *    g: position terms of GLOBE7_PLG
  */
 	double pset=2.0;
 	double t[14];
@@ -845,60 +928,60 @@ double glob7s(double *p, struct nrlmsise_input *input, struct nrlmsise_flags *fl
 	t[0] = p[21]*dfa;
 
 	/* time independent */
-	t[1]=p[1]*plg[0][2] + p[2]*plg[0][4] + p[22]*plg[0][6] + p[26]*plg[0][1] + p[14]*plg[0][3] + p[59]*plg[0][5];
+	t[1]=p[1]*g->plg[0][2] + p[2]*g->plg[0][4] + p[22]*g->plg[0][6] + p[26]*g->plg[0][1] + p[14]*g->plg[0][3] + p[59]*g->plg[0][5];
 
         /* SYMMETRICAL ANNUAL */
-	t[2]=(p[18]+p[47]*plg[0][2]+p[29]*plg[0][4])*cd32;
+	t[2]=(p[18]+p[47]*g->plg[0][2]+p[29]*g->plg[0][4])*cd32;
 
         /* SYMMETRICAL SEMIANNUAL */
-	t[3]=(p[15]+p[16]*plg[0][2]+p[30]*plg[0][4])*cd18;
+	t[3]=(p[15]+p[16]*g->plg[0][2]+p[30]*g->plg[0][4])*cd18;
 
         /* ASYMMETRICAL ANNUAL */
-	t[4]=(p[9]*plg[0][1]+p[10]*plg[0][3]+p[20]*plg[0][5])*cd14;
+	t[4]=(p[9]*g->plg[0][1]+p[10]*g->plg[0][3]+p[20]*g->plg[0][5])*cd14;
 
 	/* ASYMMETRICAL SEMIANNUAL */
-	t[5]=(p[37]*plg[0][1])*cd39;
+	t[5]=(p[37]*g->plg[0][1])*cd39;
 
         /* DIURNAL */
 	if (flags->sw[7]) {
 		double t71, t72;
-		t71 = p[11]*plg[1][2]*cd14*flags->swc[5];
-		t72 = p[12]*plg[1][2]*cd14*flags->swc[5];
-		t[6] = ((p[3]*plg[1][1] + p[4]*plg[1][3] + t71) * ctloc + (p[6]*plg[1][1] + p[7]*plg[1][3] + t72) * stloc) ;
+		t71 = p[11]*g->plg[1][2]*cd14*flags->swc[5];
+		t72 = p[12]*g->plg[1][2]*cd14*flags->swc[5];
+		t[6] = ((p[3]*g->plg[1][1] + p[4]*g->plg[1][3] + t71) * g->ctloc + (p[6]*g->plg[1][1] + p[7]*g->plg[1][3] + t72) * g->stloc) ;
 	}
 
 	/* SEMIDIURNAL */
 	if (flags->sw[8]) {
 		double t81, t82;
-		t81 = (p[23]*plg[2][3]+p[35]*plg[2][5])*cd14*flags->swc[5];
-		t82 = (p[33]*plg[2][3]+p[36]*plg[2][5])*cd14*flags->swc[5];
-		t[7] = ((p[5]*plg[2][2] + p[41]*plg[2][4] + t81) * c2tloc + (p[8]*plg[2][2] + p[42]*plg[2][4] + t82) * s2tloc);
+		t81 = (p[23]*g->plg[2][3]+p[35]*g->plg[2][5])*cd14*flags->swc[5];
+		t82 = (p[33]*g->plg[2][3]+p[36]*g->plg[2][5])*cd14*flags->swc[5];
+		t[7] = ((p[5]*g->plg[2][2] + p[41]*g->plg[2][4] + t81) * g->c2tloc + (p[8]*g->plg[2][2] + p[42]*g->plg[2][4] + t82) * g->s2tloc);
 	}
 
 	/* TERDIURNAL */
 	if (flags->sw[14]) {
-		t[13] = p[39] * plg[3][3] * s3tloc + p[40] * plg[3][3] * c3tloc;
+		t[13] = p[39] * g->plg[3][3] * g->s3tloc + p[40] * g->plg[3][3] * g->c3tloc;
 	}
 
 	/* MAGNETIC ACTIVITY */
 	if (flags->sw[9]) {
 		if (flags->sw[9]==1)
-			t[8] = apdf * (p[32] + p[45] * plg[0][2] * flags->swc[2]);
+			t[8] = apdf * (p[32] + p[45] * g->plg[0][2] * flags->swc[2]);
 		if (flags->sw[9]==-1)	
-			t[8]=(p[50]*apt[0] + p[96]*plg[0][2] * apt[0]*flags->swc[2]);
+			t[8]=(p[50]*apt[0] + p[96]*g->plg[0][2] * apt[0]*flags->swc[2]);
 	}
 
 	/* LONGITUDINAL */
 	if (!((flags->sw[10]==0) || (flags->sw[11]==0) || (input->g_long<=-1000.0))) {
-		t[10] = (1.0 + plg[0][1]*(p[80]*flags->swc[5]*cos(dr*(input->doy-p[81]))\
+		t[10] = (1.0 + g->plg[0][1]*(p[80]*flags->swc[5]*cos(dr*(input->doy-p[81]))\
 		        +p[85]*flags->swc[6]*cos(2.0*dr*(input->doy-p[86])))\
 			+p[83]*flags->swc[3]*cos(dr*(input->doy-p[84]))\
 			+p[87]*flags->swc[4]*cos(2.0*dr*(input->doy-p[88])))\
-			*((p[64]*plg[1][2]+p[65]*plg[1][4]+p[66]*plg[1][6]\
-			+p[74]*plg[1][1]+p[75]*plg[1][3]+p[76]*plg[1][5]\
+			*((p[64]*g->plg[1][2]+p[65]*g->plg[1][4]+p[66]*g->plg[1][6]\
+			+p[74]*g->plg[1][1]+p[75]*g->plg[1][3]+p[76]*g->plg[1][5]\
 			)*cos(dgtr*input->g_long)\
-			+(p[90]*plg[1][2]+p[91]*plg[1][4]+p[92]*plg[1][6]\
-			+p[77]*plg[1][1]+p[78]*plg[1][3]+p[79]*plg[1][5]\
+			+(p[90]*g->plg[1][2]+p[91]*g->plg[1][4]+p[92]*g->plg[1][6]\
+			+p[77]*g->plg[1][1]+p[78]*g->plg[1][3]+p[79]*g->plg[1][5]\
 			)*sin(dgtr*input->g_long));
 	}
 	tt=0;
@@ -929,6 +1012,7 @@ void gtd7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 	double dmr;
 	double dz28;
 	struct nrlmsise_output soutput;
+	struct globe7_point g;
 	int i;
 
 	tselec(flags);
@@ -968,12 +1052,13 @@ void gtd7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
  *         Temperature at nodes and gradients at end nodes
  *         Inverse temperature a linear function of spherical harmonics
  */
+	globe7_plg(input, flags, &g);
 	meso_tgn2[0]=meso_tgn1[1];
 	meso_tn2[0]=meso_tn1[4];
-        meso_tn2[1]=pma[0][0]*pavgm[0]/(1.0-flags->sw[20]*glob7s(pma[0], input, flags));
-        meso_tn2[2]=pma[1][0]*pavgm[1]/(1.0-flags->sw[20]*glob7s(pma[1], input, flags));
-        meso_tn2[3]=pma[2][0]*pavgm[2]/(1.0-flags->sw[20]*flags->sw[22]*glob7s(pma[2], input, flags));
-	meso_tgn2[1]=pavgm[8]*pma[9][0]*(1.0+flags->sw[20]*flags->sw[22]*glob7s(pma[9], input, flags))*meso_tn2[3]*meso_tn2[3]/(pow((pma[2][0]*pavgm[2]),2.0));
+        meso_tn2[1]=pma[0][0]*pavgm[0]/(1.0-flags->sw[20]*glob7s(pma[0], &g, input, flags));
+        meso_tn2[2]=pma[1][0]*pavgm[1]/(1.0-flags->sw[20]*glob7s(pma[1], &g, input, flags));
+        meso_tn2[3]=pma[2][0]*pavgm[2]/(1.0-flags->sw[20]*flags->sw[22]*glob7s(pma[2], &g, input, flags));
+	meso_tgn2[1]=pavgm[8]*pma[9][0]*(1.0+flags->sw[20]*flags->sw[22]*glob7s(pma[9], &g, input, flags))*meso_tn2[3]*meso_tn2[3]/(pow((pma[2][0]*pavgm[2]),2.0));
 	meso_tn3[0]=meso_tn2[3];
 
 	if (input->alt<zn3[0]) {
@@ -982,11 +1067,11 @@ void gtd7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
  *         Inverse temperature a linear function of spherical harmonics
  */
 		meso_tgn3[0]=meso_tgn2[1];
-		meso_tn3[1]=pma[3][0]*pavgm[3]/(1.0-flags->sw[22]*glob7s(pma[3], input, flags));
-		meso_tn3[2]=pma[4][0]*pavgm[4]/(1.0-flags->sw[22]*glob7s(pma[4], input, flags));
-		meso_tn3[3]=pma[5][0]*pavgm[5]/(1.0-flags->sw[22]*glob7s(pma[5], input, flags));
-		meso_tn3[4]=pma[6][0]*pavgm[6]/(1.0-flags->sw[22]*glob7s(pma[6], input, flags));
-		meso_tgn3[1]=pma[7][0]*pavgm[7]*(1.0+flags->sw[22]*glob7s(pma[7], input, flags)) *meso_tn3[4]*meso_tn3[4]/(pow((pma[6][0]*pavgm[6]),2.0));
+		meso_tn3[1]=pma[3][0]*pavgm[3]/(1.0-flags->sw[22]*glob7s(pma[3], &g, input, flags));
+		meso_tn3[2]=pma[4][0]*pavgm[4]/(1.0-flags->sw[22]*glob7s(pma[4], &g, input, flags));
+		meso_tn3[3]=pma[5][0]*pavgm[5]/(1.0-flags->sw[22]*glob7s(pma[5], &g, input, flags));
+		meso_tn3[4]=pma[6][0]*pavgm[6]/(1.0-flags->sw[22]*glob7s(pma[6], &g, input, flags));
+		meso_tgn3[1]=pma[7][0]*pavgm[7]*(1.0+flags->sw[22]*glob7s(pma[7], &g, input, flags)) *meso_tn3[4]*meso_tn3[4]/(pow((pma[6][0]*pavgm[6]),2.0));
 	}
 
         /* LINEAR TRANSITION TO FULL MIXING BELOW zn2[0] */
@@ -1136,10 +1221,14 @@ void ghp7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 /* ------------------------------- GTS7 ------------------------------ */
 /* ------------------------------------------------------------------- */
 
-void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrlmsise_output *output) {
+static void gts7_core(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct gts7_epoch *ep, struct globe7_point *g, struct nrlmsise_output *output, int all_outputs) {
 /*     Thermospheric portion of NRLMSISE-00
  *     See GTD7 for more extensive comments
  *     alt > 72.5 km! 
+ *     ep, g: epoch terms of GTS7_EPOCH_TERMS and position terms of
+ *     GLOBE7_PLG for this input
+ *     If all_outputs is 0, only the species in the total mass density
+ *     d[5] are computed (no anomalous oxygen d[8], t[1] not final)
  */
 	double za;
 	int i, j;
@@ -1179,7 +1268,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 	/* TINF VARIATIONS NOT IMPORTANT BELOW ZA OR ZN1(1) */
 	if (input->alt>zn1[0])
 		tinf = ptm[0]*pt[0] * \
-			(1.0+flags->sw[16]*globe7(pt,input,flags));
+			(1.0+flags->sw[16]*globe7_eval(pt, &ep->pt, g, input, flags));
 	else
 		tinf = ptm[0]*pt[0];
 	output->t[0]=tinf;
@@ -1187,20 +1276,20 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 	/*  GRADIENT VARIATIONS NOT IMPORTANT BELOW ZN1(5) */
 	if (input->alt>zn1[4])
 		g0 = ptm[3]*ps[0] * \
-			(1.0+flags->sw[19]*globe7(ps,input,flags));
+			(1.0+flags->sw[19]*globe7_eval(ps, &ep->ps, g, input, flags));
 	else
 		g0 = ptm[3]*ps[0];
-	tlb = ptm[1] * (1.0 + flags->sw[17]*globe7(pd[3],input,flags))*pd[3][0];
+	tlb = ptm[1] * (1.0 + flags->sw[17]*globe7_eval(pd[3], &ep->pd[3], g, input, flags))*pd[3][0];
 	s = g0 / (tinf - tlb);
 
 /*      Lower thermosphere temp variations not significant for
  *       density above 300 km */
 	if (input->alt<300.0) {
-		meso_tn1[1]=ptm[6]*ptl[0][0]/(1.0-flags->sw[18]*glob7s(ptl[0], input, flags));
-		meso_tn1[2]=ptm[2]*ptl[1][0]/(1.0-flags->sw[18]*glob7s(ptl[1], input, flags));
-		meso_tn1[3]=ptm[7]*ptl[2][0]/(1.0-flags->sw[18]*glob7s(ptl[2], input, flags));
-		meso_tn1[4]=ptm[4]*ptl[3][0]/(1.0-flags->sw[18]*flags->sw[20]*glob7s(ptl[3], input, flags));
-		meso_tgn1[1]=ptm[8]*pma[8][0]*(1.0+flags->sw[18]*flags->sw[20]*glob7s(pma[8], input, flags))*meso_tn1[4]*meso_tn1[4]/(pow((ptm[4]*ptl[3][0]),2.0));
+		meso_tn1[1]=ptm[6]*ptl[0][0]/(1.0-flags->sw[18]*glob7s(ptl[0], g, input, flags));
+		meso_tn1[2]=ptm[2]*ptl[1][0]/(1.0-flags->sw[18]*glob7s(ptl[1], g, input, flags));
+		meso_tn1[3]=ptm[7]*ptl[2][0]/(1.0-flags->sw[18]*glob7s(ptl[2], g, input, flags));
+		meso_tn1[4]=ptm[4]*ptl[3][0]/(1.0-flags->sw[18]*flags->sw[20]*glob7s(ptl[3], g, input, flags));
+		meso_tgn1[1]=ptm[8]*pma[8][0]*(1.0+flags->sw[18]*flags->sw[20]*glob7s(pma[8], g, input, flags))*meso_tn1[4]*meso_tn1[4]/(pow((ptm[4]*ptl[3][0]),2.0));
 	} else {
 		meso_tn1[1]=ptm[6]*ptl[0][0];
 		meso_tn1[2]=ptm[2]*ptl[1][0];
@@ -1210,7 +1299,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 	}
 
 	/* N2 variation factor at Zlb */
-	g28=flags->sw[21]*globe7(pd[2], input, flags);
+	g28=flags->sw[21]*globe7_eval(pd[2], &ep->pd[2], g, input, flags);
 
 	/* VARIATION OF TURBOPAUSE HEIGHT */
 	zhf=pdl[1][24]*(1.0+flags->sw[5]*pdl[0][24]*sin(dgtr*input->g_lat)*cos(dr*(input->doy-pt[13])));
@@ -1243,7 +1332,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** HE DENSITY ****/
 
 	/*   Density variation factor at Zlb */
-	g4 = flags->sw[21]*globe7(pd[0], input, flags);
+	g4 = flags->sw[21]*globe7_eval(pd[0], &ep->pd[0], g, input, flags);
 	/*  Diffusive density at Zlb */
 	db04 = pdm[0][0]*exp(g4)*pd[0][0];
         /*  Diffusive density at Alt */
@@ -1271,7 +1360,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** O DENSITY ****/
 
 	/*  Density variation factor at Zlb */
-	g16= flags->sw[21]*globe7(pd[1],input,flags);
+	g16= flags->sw[21]*globe7_eval(pd[1], &ep->pd[1], g, input, flags);
 	/*  Diffusive density at Zlb */
 	db16 =  pdm[1][0]*exp(g16)*pd[1][0];
         /*   Diffusive density at Alt */
@@ -1304,7 +1393,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** O2 DENSITY ****/
 
         /*   Density variation factor at Zlb */
-	g32= flags->sw[21]*globe7(pd[4], input, flags);
+	g32= flags->sw[21]*globe7_eval(pd[4], &ep->pd[4], g, input, flags);
         /*  Diffusive density at Zlb */
 	db32 = pdm[3][0]*exp(g32)*pd[4][0];
         /*   Diffusive density at Alt */
@@ -1340,7 +1429,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** AR DENSITY ****/
 
         /*   Density variation factor at Zlb */
-	g40= flags->sw[21]*globe7(pd[5],input,flags);
+	g40= flags->sw[21]*globe7_eval(pd[5], &ep->pd[5], g, input, flags);
         /*  Diffusive density at Zlb */
 	db40 = pdm[4][0]*exp(g40)*pd[5][0];
 	/*   Diffusive density at Alt */
@@ -1368,7 +1457,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** HYDROGEN DENSITY ****/
 
         /*   Density variation factor at Zlb */
-	g1 = flags->sw[21]*globe7(pd[6], input, flags);
+	g1 = flags->sw[21]*globe7_eval(pd[6], &ep->pd[6], g, input, flags);
         /*  Diffusive density at Zlb */
 	db01 = pdm[5][0]*exp(g1)*pd[6][0];
         /*   Diffusive density at Alt */
@@ -1401,7 +1490,7 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
         /**** ATOMIC NITROGEN DENSITY ****/
 
 	/*   Density variation factor at Zlb */
-	g14 = flags->sw[21]*globe7(pd[7],input,flags);
+	g14 = flags->sw[21]*globe7_eval(pd[7], &ep->pd[7], g, input, flags);
         /*  Diffusive density at Zlb */
 	db14 = pdm[6][0]*exp(g14)*pd[7][0];
         /*   Diffusive density at Alt */
@@ -1433,14 +1522,16 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 
         /**** Anomalous OXYGEN DENSITY ****/
 
-	g16h = flags->sw[21]*globe7(pd[8],input,flags);
-	db16h = pdm[7][0]*exp(g16h)*pd[8][0];
-	tho = pdm[7][9]*pdl[0][6];
-	dd=densu(z,db16h,tho,tho,16.,alpha[8],&output->t[1],ptm[5],s,mn1, zn1,meso_tn1,meso_tgn1);
-	zsht=pdm[7][5];
-	zmho=pdm[7][4];
-	zsho=scalh(zmho,16.0,tho);
-	output->d[8]=dd*exp(-zsht/zsho*(exp(-(z-zmho)/zsht)-1.));
+	if (all_outputs) {
+		g16h = flags->sw[21]*globe7_eval(pd[8], &ep->pd[8], g, input, flags);
+		db16h = pdm[7][0]*exp(g16h)*pd[8][0];
+		tho = pdm[7][9]*pdl[0][6];
+		dd=densu(z,db16h,tho,tho,16.,alpha[8],&output->t[1],ptm[5],s,mn1, zn1,meso_tn1,meso_tgn1);
+		zsht=pdm[7][5];
+		zmho=pdm[7][4];
+		zsho=scalh(zmho,16.0,tho);
+		output->d[8]=dd*exp(-zsht/zsho*(exp(-(z-zmho)/zsht)-1.));
+	}
 
 
 	/* total mass density */
@@ -1448,12 +1539,116 @@ void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrl
 
 
 	/* temperature */
-	z = sqrt(input->alt*input->alt);
-	ddum = densu(z,1.0, tinf, tlb, 0.0, 0.0, &output->t[1], ptm[5], s, mn1, zn1, meso_tn1, meso_tgn1);
-	(void) ddum; /* silence gcc */
+	if (all_outputs) {
+		z = sqrt(input->alt*input->alt);
+		ddum = densu(z,1.0, tinf, tlb, 0.0, 0.0, &output->t[1], ptm[5], s, mn1, zn1, meso_tn1, meso_tgn1);
+		(void) ddum; /* silence gcc */
+	}
 	if (flags->sw[0]) {
 		for(i=0;i<9;i++)
 			output->d[i]=output->d[i]*1.0E6;
 		output->d[5]=output->d[5]/1000;
 	}
 }
+
+void gts7(struct nrlmsise_input *input, struct nrlmsise_flags *flags, struct nrlmsise_output *output) {
+/*     Thermospheric portion of NRLMSISE-00
+ *     See GTD7 for more extensive comments
+ *     alt > 72.5 km! 
+ */
+	struct gts7_epoch ep;
+	struct globe7_point g;
+
+	gts7_epoch_terms(input, flags, &ep, 1);
+	globe7_plg(input, flags, &g);
+	gts7_core(input, flags, &ep, &g, output, 1);
+}
+
+
+
+/* ------------------------------------------------------------------- */
+/* ------------------------------ GTD7_RHO --------------------------- */
+/* ------------------------------------------------------------------- */
+
+double gtd7_rho(struct nrlmsise_input *input, struct nrlmsise_flags *flags) {
+/*     Total mass density d[5] of GTD7 only. Above zn2[0] the anomalous
+ *     oxygen and the temperature at altitude are not computed; the
+ *     result is identical to GTD7 d[5]
+ */
+	double xlat;
+	struct gts7_epoch ep;
+	struct globe7_point g;
+	struct nrlmsise_output output;
+
+	if (input->alt<72.5) {
+		gtd7(input, flags, &output);
+		return output.d[5];
+	}
+
+	tselec(flags);
+
+	/* Latitude variation of gravity (none for sw[2]=0) */
+	xlat=input->g_lat;
+	if (flags->sw[2]==0)
+		xlat=45.0;
+	glatf(xlat, &gsurf, &re);
+
+	gts7_epoch_terms(input, flags, &ep, 0);
+	globe7_plg(input, flags, &g);
+	gts7_core(input, flags, &ep, &g, &output, 0);
+	return output.d[5];
+}
+
+
+
+/* ------------------------------------------------------------------- */
+/* --------------------------- GTD7_RHO_BATCH ------------------------ */
+/* ------------------------------------------------------------------- */
+
+void gtd7_rho_batch(struct nrlmsise_input *epoch, int n, double *alt, double *g_lat, double *g_long, double *lst, struct nrlmsise_flags *flags, double *rho) {
+/*     Total mass density d[5] of GTD7 at n points that share the epoch
+ *     and space weather of epoch. The epoch terms of G(L) are computed
+ *     once; the position terms of each block of points are computed
+ *     together before the points are evaluated. Each result is
+ *     identical to GTD7_RHO
+ */
+	int i, j, k;
+	double xlat;
+	struct gts7_epoch ep;
+	struct globe7_point g[GTD7_BATCH];
+	struct nrlmsise_input input[GTD7_BATCH];
+	struct nrlmsise_output output;
+
+	tselec(flags);
+	gts7_epoch_terms(epoch, flags, &ep, 0);
+
+	for (i=0;i<n;i+=GTD7_BATCH) {
+		k = (n-i<GTD7_BATCH) ? n-i : GTD7_BATCH;
+
+		/* position terms of the block */
+		for (j=0;j<k;j++) {
+			input[j] = *epoch;
+			input[j].alt = alt[i+j];
+			input[j].g_lat = g_lat[i+j];
+			input[j].g_long = g_long[i+j];
+			input[j].lst = lst[i+j];
+			globe7_plg(&input[j], flags, &g[j]);
+		}
+
+		for (j=0;j<k;j++) {
+			if (input[j].alt<72.5) {
+				rho[i+j] = gtd7_rho(&input[j], flags);
+				continue;
+			}
+
+			/* Latitude variation of gravity (none for sw[2]=0) */
+			xlat=input[j].g_lat;
+			if (flags->sw[2]==0)
+				xlat=45.0;
+			glatf(xlat, &gsurf, &re);
+
+			gts7_core(&input[j], flags, &ep, &g[j], &output, 0);
+			rho[i+j] = output.d[5];
+		}
+	}
+}
@@ -186,6 +186,32 @@ void gtd7d(struct nrlmsise_input *input, \
            struct nrlmsise_output *output);
 
 
+/* GTD7_RHO */
+/*   Total mass density only (output d[5] of GTD7, in the units selected
+ *   by switch 0). Skips the outputs that do not contribute to d[5].
+ */
+double gtd7_rho(struct nrlmsise_input *input, \
+                struct nrlmsise_flags *flags);
+
+
+/* GTD7_RHO_BATCH */
+/*   Total mass density (as GTD7_RHO) at n points alt[i], g_lat[i],
+ *   g_long[i], lst[i] that share the epoch and space weather of epoch
+ *   (doy, sec, f107, f107A, ap, ap_a; its position is ignored), written
+ *   to rho[0..n-1]. The terms that depend only on the epoch are
+ *   evaluated once for all points, e.g. a table or a fragment cloud at
+ *   one time.
+ */
+void gtd7_rho_batch(struct nrlmsise_input *epoch, \
+                    int n, \
+                    double *alt, \
+                    double *g_lat, \
+                    double *g_long, \
+                    double *lst, \
+                    struct nrlmsise_flags *flags, \
+                    double *rho);
+
+
 /* GTS7 */
 /*   Thermospheric portion of NRLMSISE-00
  */
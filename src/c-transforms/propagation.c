@@ -21,39 +21,59 @@
 //%                       double I_inv[3][3]: inverse of inertia matrix
 //%                       double M[3][3]: magnetic tensor
 //%                       double m: spacecraft mass
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
 //%                       double C[101][101]: gravity potential coefficients
 //%                       double S[101][101]: gravity potential coefficients
 //%                       int length_of_file[5]: array containing length of file values
-//%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
-//%                       double solar_input[length_of_file[1]][3]: F10.7 array for NRLMSISE-00
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct density_cache *dc: along-track density cache
+//%                       struct jb2008_cache *jc: JB2008 inputs of the
+//%                         current epoch
+//%                       const struct density_table *dtab: precomputed
+//%                         density table (used if model_parameters[30] is 1)
+//%                       const struct model_gating *mg: models skipped and
+//%                         gravity degree limit (see gate_models.c)
+//%                       struct wind_cache *wc: along-track HWM14 wind cache
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native HWM14 model
+//%                       struct magnet_coef *mc: magnetic potential
+//%                         coefficient cache
+//%                       struct magnet_arc *ma: along-track fit of the
+//%                         magnetic field
+//%                       struct time_scales *ts: leap second table and time
+//%                         scales of the current epoch
+//%                       struct frame_cache *fc: TEME/ECEF rotation of the
+//%                         current epoch
 //%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
 //%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
 //%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
 //%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
-//%                       double model_parameters[27]: model parameters
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
 //%                       double eop[length_of_file[2]][10]: earth orientation parameters
 //%                       double sun_eph[length_of_file[3]][3]: sun ephemerides array
 //%                       double moon_eph[length_of_file[4]][3]: moon ephemerides array
+//%                       struct cheb_ephemeris eph_cheb[2]: Sun and Moon
+//%                         Chebyshev ephemerides
 //%                       double albedo[12][20][40][2]: albedo and IR coefficients
 //%                       double fn[3]: 3x1 vector sum of non-conservative forces
 //%                       double gn[3]: 3x1 vector sum of non-conservative torques
 //%                       double fg_i[42]: array containing list of 3x1 vector of forces
 //%                         and torques
 //%
-//% OUTPUT:               double dx[13]: state vector update
+//% OUTPUT:               double energy[3]: potential energies (J) from the
+//%                         Earth, Sun and Moon, only computed if the work file
+//%                         is output (model_parameters[25])
+//%                       double dx[13]: state vector update
 //%                       double dxd[7]: state vector update (Kane damper)
 //%
 //% COUPLING:             - quatnormalize.c
-//%                       - teme2ecef.c
+//%                       - teme2ecef_cached.c
 //%                       - ecef2lla.c
-//%                       - quat2dcm.c
-//%                       - matxvec.c
-//%                       - surface.h
-//%                       - t2doy.c
-//%                       - tt2utc.c
-//%                       - invertmat.c
+//%                       - linalg.h
+//%                       - facets.h
+//%                       - facet_table.h
+//%                       - time_scales_update.c
 //%                       - angvelprop.c
 //%                       - moon.c
 //%                       - sun.c
@@ -62,40 +82,48 @@
 //%                       - gravity_field.c
 //%                       - srp.c
 //%                       - albedo_calc.c
-//%                       - get_density.c
+//%                       - density_cached.c
+//%                       - density_table_eval.c
 //%                       - wind.c
+//%                       - magnet_coef_update.c
+//%                       - magnet_dipole.c
 //%                       - magnet_field.c
-//%                       - magnet_field_wmm.c
+//%                       - magnet_field_arc.c
 //%                       - aero_drag.c
+//%                       - sun_potential.c
+//%                       - moon_potential.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "propagation.h"
 #include "quatnormalize.h"
+#include "linalg.h"
 #include "angvelprop.h"
 #include <math.h>
-#include "teme2ecef.h"
+#include "teme2ecef_cached.h"
 #include "ecef2lla.h"
 #include "gravity_field.h"
-#include "quat2dcm.h"
 #include "eddy_torque.h"
-#include "matxvec.h"
-#include "get_density.h"
+#include "density_cached.h"
+#include "density_table_eval.h"
 #include "aero_drag.h"
-#include "surface.h"
+#include "facets.h"
+#include "facet_table.h"
+#include "magnet_coef_update.h"
+#include "magnet_dipole.h"
 #include "magnet_field.h"
-#include "magnet_field_wmm.h"
+#include "magnet_field_arc.h"
 #include "wind.h"
-#include "t2doy.h"
 #include "moon.h"
 #include "sun.h"
 #include "third_body.h"
-#include "tt2utc.h"
+#include "time_scales_update.h"
 #include "srp.h"
-#include "invertmat.h"
+#include "sun_potential.h"
+#include "moon_potential.h"
 #include "albedo_calc.h"
 
-void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_inv[3][3], double M[3][3], double m, int n_surf, struct surface geometry[n_surf], double C[101][101], double S[101][101], int length_of_file[5], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double model_parameters[27], double eop[length_of_file[2]][10], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], double albedo[12][20][40][2], double fn[3], double gn[3], double fg_i[42], double dx[13], double xd[7], double dxd[7]){
+void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_inv[3][3], double M[3][3], double m, struct facets *fa, const struct facet_table *ft, double C[101][101], double S[101][101], int length_of_file[5], const struct space_weather *sw, struct density_cache *dc, struct jb2008_cache *jc, const struct density_table *dtab, const struct model_gating *mg, struct wind_cache *wc, const struct hwm14_model *hwm, struct magnet_coef *mc, struct magnet_arc *ma, struct time_scales *ts, struct frame_cache *fc, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double model_parameters[N_MODEL_PARAMETERS], double eop[length_of_file[2]][10], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], struct cheb_ephemeris eph_cheb[2], double albedo[12][20][40][2], double fn[3], double gn[3], double fg_i[42], double energy[3], double dx[13], double xd[7], double dxd[7]){
     
     // Initialize parameters
     double v[3], p[3], w[3], q[4], wd[3], qd[4];
@@ -133,6 +161,7 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
     int in_alb_g = model_parameters[11];
     int in_ir_g = model_parameters[12];
     int in_kane = model_parameters[13];
+    int in_work = model_parameters[25];
     
     // Initialize Kane damper state parameter
     if (in_kane) {
@@ -146,12 +175,42 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
     // Atmospheric Model
     int atmos_model = model_parameters[19];
     
-    // Magnetic Model
+    // Precomputed density table (outside its altitudes, the model is used)
+    int in_dens_table = model_parameters[30];
+    
+    // Magnetic Model (fidelity: 0 full, 1 degree-limited, 2 eccentric
+    // dipole, 3 along-track fit)
     int magnetic_model = model_parameters[20];
+    int magnetic_fidelity = model_parameters[35];
+    int l_max_m = model_parameters[36];
+    if ((l_max_m == 0) || (magnetic_fidelity == 0))
+        l_max_m = (magnetic_model==1) ? 13 : 12;
     
     // Horizontal Wind Model
     int wind_model = model_parameters[21];
     
+    // Sun/Moon Ephemeris Model
+    int eph_model = model_parameters[27];
+    
+    // Automatic model gating (models skipped for their magnitude are
+    // evaluated during probe steps, co-rotating winds replace HWM14)
+    if ((mg->off_aero == 2) || ((mg->off_aero == 1) && !mg->probe)){
+        in_aero_a = 0;
+        in_aero_g = 0;
+    }
+    if (mg->off_wind)
+        wind_model = 0;
+    if (mg->off_alb && !mg->probe){
+        in_alb_a = 0;
+        in_alb_g = 0;
+    }
+    if (mg->off_ir && !mg->probe){
+        in_ir_a = 0;
+        in_ir_g = 0;
+    }
+    if (mg->l_max_a > 0)
+        l_max_a = mg->l_max_a;
+    
     // Initialize torque and acceleration
     double a[3], g[3], an[3];
     for (int i=0; i<3; i++){
@@ -164,44 +223,40 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
     for (int i=0; i<42; i++){
         fg_i[i] = 0;
     }
+    for (int i=0; i<3; i++){
+        energy[i] = 0;
+    }
     
-    // TT to UTC
-    double t2000utc;
-    t2000utc = tt2utc(t2000tt);
-    double ttt = (t2000tt-(12*60*60.0))/(60*60*24*36525.0);   // julian centuries of TT
-    
-    // Day of Year UTC
-    int time[3];
-    double sec = t2doy(t2000utc, time);
-    int d2000 = time[2];   // Day Number starting January 1, 2000
-    
-    // Get Earth Orientation Parameters (Not currently used)
-    double dut1 = 0;// Not considering UTC vs UT1 difference for simplicity
-    double t2000ut1 = t2000utc + dut1;
-    double xp = 0;// TEME to ECEF only considering GMST sidereal time
-    double yp = 0;// TEME to ECEF only considering GMST sidereal time
-    double lod = 0;// TEME to ECEF only considering GMST sidereal time
+    // UTC, UT1, day of year and Earth orientation parameters (shared by the
+    // stages of a step, zero EOP means TEME to ECEF with GMST only)
+    time_scales_update(ts, t2000tt, model_parameters[37], length_of_file[2], eop);
+    double t2000utc = ts->t2000utc;
+    double t2000ut1 = ts->t2000ut1;
+    double ttt = ts->ttt;   // julian centuries of TT
+    double xp = ts->xp;
+    double yp = ts->yp;
+    double lod = ts->lod;
     
     // Get position in ECEF frame and LLA coordinates
     double p_ecef[3], v_ecef[3], C_ecef2teme[3][3], LLA[4];
-    teme2ecef(p, v, ttt, t2000ut1, xp, yp, lod, p_ecef, v_ecef, C_ecef2teme);
+    teme2ecef_cached(fc, p, v, ttt, t2000ut1, xp, yp, lod, p_ecef, v_ecef, C_ecef2teme);
     ecef2lla(p_ecef, LLA);
     
     // Obtain body rotation matrix
     double C_i2b[3][3];
-    quat2dcm(q, C_i2b);
+    quat_dcm(q, C_i2b);
     
     // Sun Position
     double r_sun[3];
-    if (in_sun_a||in_srp_a||in_srp_g){
-        sun(t2000tt, length_of_file, sun_eph, r_sun);
+    if (in_sun_a||in_srp_a||in_srp_g||in_alb_a||in_alb_g||in_ir_a||in_ir_g){
+        sun(t2000tt, eph_model, length_of_file, sun_eph, &eph_cheb[0], r_sun);
     }
     
     if (in_alb_a || in_alb_g || in_ir_a || in_ir_g){
         
         // Albedo and IR Acceleration and Torque
         double a_alb[3], g_alb[3], a_ir[3], g_ir[3];
-        albedo_calc(p, v, LLA, time, r_sun, C_ecef2teme, C_i2b, n_surf, geometry, m, albedo, in_alb_a, in_alb_g, in_ir_a, in_ir_g, a_alb, g_alb, a_ir, g_ir);
+        albedo_calc(p, v, LLA, ts->time, r_sun, C_ecef2teme, C_i2b, fa, ft, m, albedo, in_alb_a, in_alb_g, in_ir_a, in_ir_g, a_alb, g_alb, a_ir, g_ir);
         for (int i=0; i<3; i++){
             g[i] = g[i] + g_ir[i] + g_alb[i];
             a[i] = a[i] + a_ir[i] + a_alb[i];
@@ -219,7 +274,7 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
         
         // Solar Radiation Pressure Acceleration and Torque
         double a_srp[3], g_srp[3];
-        srp(p, v, r_sun, C_i2b, n_surf, geometry, m, in_srp_a, in_srp_g, a_srp, g_srp);
+        srp(p, v, r_sun, C_i2b, fa, ft, m, in_srp_a, in_srp_g, a_srp, g_srp);
         for (int i=0; i<3; i++){
             g[i] = g[i] + g_srp[i];
             a[i] = a[i] + a_srp[i];
@@ -234,15 +289,16 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
         
         // Atmospheric Density
         double density;
-        density = get_density(atmos_model, LLA, t2000utc, length_of_file, ap_index, solar_input, Ap, F107);
+        if (!(in_dens_table && density_table_eval(dtab, LLA, t2000utc, &density)))
+            density = density_cached(dc, atmos_model, LLA, t2000utc, sw, jc, Ap, F107);
         
         // Horizontal Winds
         double winds_i[3];
-        wind(p_ecef, LLA, t2000utc, length_of_file, ap_index, C_ecef2teme, wind_model, winds_i);
+        wind(p_ecef, LLA, t2000utc, sw, wc, hwm, C_ecef2teme, wind_model, winds_i);
         
         // Aerodynamic Acceleration and Torque
         double a_aero[3], g_aero[3];
-        aero_drag(density, winds_i, p, v, w, C_i2b, n_surf, geometry, m, Cd, in_aero_a, in_aero_g, a_aero, g_aero);
+        aero_drag(density, winds_i, p, v, w, C_i2b, fa, ft, m, Cd, in_aero_a, in_aero_g, a_aero, g_aero);
         for (int i=0; i<3; i++){
             g[i] = g[i] + g_aero[i];
             a[i] = a[i] + a_aero[i];
@@ -258,13 +314,18 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
         
         // Magnetic Field
         double B_field_i[3], B_field_i_dot[3];
-        if (magnetic_model==1)
-            magnet_field(t2000utc, p, p_ecef, v_ecef, LLA, C_ecef2teme, G, H, B_field_i, B_field_i_dot);
-        else if (magnetic_model==2)
-            magnet_field_wmm(t2000utc, p, p_ecef, v_ecef, LLA, C_ecef2teme, G_wmm, H_wmm, B_field_i, B_field_i_dot);
+        if (magnetic_fidelity==3)
+            magnet_field_arc(ma, mc, t2000utc, p, v, C_ecef2teme, magnetic_model, l_max_m, G, H, G_wmm, H_wmm, B_field_i, B_field_i_dot);
+        else {
+            magnet_coef_update(mc, t2000utc, magnetic_model, G, H, G_wmm, H_wmm);
+            if (magnetic_fidelity==2)
+                magnet_dipole(p_ecef, v_ecef, C_ecef2teme, mc, B_field_i, B_field_i_dot);
+            else
+                magnet_field(p_ecef, v_ecef, LLA, C_ecef2teme, mc, l_max_m, B_field_i, B_field_i_dot);
+        }
         double B_field_b[3], B_field_dot_b[3];
-        matxvec(C_i2b,B_field_i,B_field_b);
-        matxvec(C_i2b,B_field_i_dot,B_field_dot_b);
+        mat3_vec(C_i2b,B_field_i,B_field_b);
+        mat3_vec(C_i2b,B_field_i_dot,B_field_dot_b);
         
         // Eddy Current Torque
         double g_eddy[3];
@@ -289,6 +350,8 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
             a[i] = a[i] + a_sun[i];
             fg_i[i+15] = a_sun[i];
         }
+        if (in_work)
+            energy[1] = sun_potential(p, m, r_sun);
         
     }
     
@@ -297,20 +360,23 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
         // Third-body accelerations: Moon
         double r_moon[3], a_moon[3];
         double mu_moon = 4902.799 * pow(10,9);
-        moon(t2000tt, length_of_file, moon_eph, r_moon);
+        moon(t2000tt, eph_model, length_of_file, moon_eph, &eph_cheb[1], r_moon);
         third_body(p, r_moon, mu_moon, a_moon);
         for (int i=0; i<3; i++){
             a[i] = a[i] + a_moon[i];
             fg_i[i+18] = a_moon[i];
         }
+        if (in_work)
+            energy[2] = moon_potential(p, m, r_moon);
         
     }
     
     if (in_grav_a || in_grav_g){
         
         // Gravitational Torque and Acceleration
-        double g_grav_b[3], a_grav[3];
-        gravity_field(p_ecef, p, LLA, C_i2b, Inertia, C, S, l_max_a, l_max_g, in_grav_a, in_grav_g, a_grav, g_grav_b);
+        double g_grav_b[3], a_grav[3], U_grav = 0;
+        gravity_field(p_ecef, p, LLA, C_i2b, Inertia, C, S, l_max_a, l_max_g, in_grav_a, in_grav_g, a_grav, g_grav_b, in_work ? &U_grav : NULL);
+        energy[0] = U_grav*m;
         for (int i=0; i<3; i++){
             g[i] = g[i] + g_grav_b[i];
             a[i] = a[i] + a_grav[i];
@@ -324,21 +390,21 @@ void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_in
     double gd[3];
     if (in_kane) {
         double C_i2d[3][3], C_d2i[3][3], C_b2i[3][3];
-        quat2dcm(qd, C_i2d);
-        invertmat(C_i2d, C_d2i);
-        invertmat(C_i2b, C_b2i);
+        quat_dcm(qd, C_i2d);
+        mat3_transpose(C_i2d, C_d2i);
+        mat3_transpose(C_i2b, C_b2i);
         double gd_body[3], gd_i[3];
         double wd_body[3], wd_i[3];
-        matxvec(C_d2i,wd,wd_i);
-        matxvec(C_i2b,wd_i,wd_body);
+        mat3_vec(C_d2i,wd,wd_i);
+        mat3_vec(C_i2b,wd_i,wd_body);
         for (int i=0; i<3; i++){
             gd_body[i] = C_damper*(w[i]-wd_body[i]);  // Torque of spacecraft on spherical damper in body frame
             g[i] = g[i] - gd_body[i];
             fg_i[i+39] = -gd_body[i];
             gn[i] = gn[i] - gd_body[i];
         }
-        matxvec(C_b2i,gd_body,gd_i);
-        matxvec(C_i2d,gd_i,gd);
+        mat3_vec(C_b2i,gd_body,gd_i);
+        mat3_vec(C_i2d,gd_i,gd);
     }
     
     /* UPDATING PARAMETERS */
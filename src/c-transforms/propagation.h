@@ -21,39 +21,59 @@
 //%                       double I_inv[3][3]: inverse of inertia matrix
 //%                       double M[3][3]: magnetic tensor
 //%                       double m: spacecraft mass
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
 //%                       double C[101][101]: gravity potential coefficients
 //%                       double S[101][101]: gravity potential coefficients
 //%                       int length_of_file[5]: array containing length of file values
-//%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
-//%                       double solar_input[length_of_file[1]][3]: F10.7 array for NRLMSISE-00
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct density_cache *dc: along-track density cache
+//%                       struct jb2008_cache *jc: JB2008 inputs of the
+//%                         current epoch
+//%                       const struct density_table *dtab: precomputed
+//%                         density table (used if model_parameters[30] is 1)
+//%                       const struct model_gating *mg: models skipped and
+//%                         gravity degree limit (see gate_models.c)
+//%                       struct wind_cache *wc: along-track HWM14 wind cache
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native HWM14 model
+//%                       struct magnet_coef *mc: magnetic potential
+//%                         coefficient cache
+//%                       struct magnet_arc *ma: along-track fit of the
+//%                         magnetic field
+//%                       struct time_scales *ts: leap second table and time
+//%                         scales of the current epoch
+//%                       struct frame_cache *fc: TEME/ECEF rotation of the
+//%                         current epoch
 //%                       double G[14][14][25]: IGRF-12 magnetic potential coefficients
 //%                       double H[14][14][25]: IGRF-12 magnetic potential coefficients
 //%                       double G_wmm[13][13][8]: WMM magnetic potential coefficients
 //%                       double H_wmm[13][13][8]: WMM magnetic potential coefficients
-//%                       double model_parameters[27]: model parameters
+//%                       double model_parameters[N_MODEL_PARAMETERS]: model parameters
 //%                       double eop[length_of_file[2]][10]: earth orientation parameters
 //%                       double sun_eph[length_of_file[3]][3]: sun ephemerides array
 //%                       double moon_eph[length_of_file[4]][3]: moon ephemerides array
+//%                       struct cheb_ephemeris eph_cheb[2]: Sun and Moon
+//%                         Chebyshev ephemerides
 //%                       double albedo[12][20][40][2]: albedo and IR coefficients
 //%                       double fn[3]: 3x1 vector sum of non-conservative forces
 //%                       double gn[3]: 3x1 vector sum of non-conservative torques
 //%                       double fg_i[42]: array containing list of 3x1 vector of forces
 //%                         and torques
 //%
-//% OUTPUT:               double dx[13]: state vector update
+//% OUTPUT:               double energy[3]: potential energies (J) from the
+//%                         Earth, Sun and Moon, only computed if the work file
+//%                         is output (model_parameters[25])
+//%                       double dx[13]: state vector update
 //%                       double dxd[7]: state vector update (Kane damper)
 //%
 //% COUPLING:             - quatnormalize.c
-//%                       - teme2ecef.c
+//%                       - teme2ecef_cached.c
 //%                       - ecef2lla.c
-//%                       - quat2dcm.c
-//%                       - matxvec.c
-//%                       - surface.h
-//%                       - t2doy.c
-//%                       - tt2utc.c
-//%                       - invertmat.c
+//%                       - linalg.h
+//%                       - facets.h
+//%                       - facet_table.h
+//%                       - time_scales_update.c
 //%                       - angvelprop.c
 //%                       - moon.c
 //%                       - sun.c
@@ -62,11 +82,16 @@
 //%                       - gravity_field.c
 //%                       - srp.c
 //%                       - albedo_calc.c
-//%                       - get_density.c
+//%                       - density_cached.c
+//%                       - density_table_eval.c
 //%                       - wind.c
+//%                       - magnet_coef_update.c
+//%                       - magnet_dipole.c
 //%                       - magnet_field.c
-//%                       - magnet_field_wmm.c
+//%                       - magnet_field_arc.c
 //%                       - aero_drag.c
+//%                       - sun_potential.c
+//%                       - moon_potential.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -74,8 +99,22 @@
 #define propagation_h
 
 #include <stdio.h>
-#include "surface.h"
+#include "load_model_parameters.h"
+#include "facets.h"
+#include "facet_table.h"
+#include "cheb_ephemeris.h"
+#include "space_weather.h"
+#include "density_cache.h"
+#include "jb2008_cache.h"
+#include "density_table.h"
+#include "model_gating.h"
+#include "wind_cache.h"
+#include "hwm14_model.h"
+#include "magnet_coef.h"
+#include "magnet_arc.h"
+#include "time_scales.h"
+#include "frame_cache.h"
 
-void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_inv[3][3], double M[3][3], double m, int n_surf, struct surface geometry[n_surf], double C[101][101], double S[101][101], int length_of_file[5], double ap_index[length_of_file[0]], double solar_input[length_of_file[1]][3], double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double model_parameters[27], double eop[length_of_file[2]][10], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], double albedo[12][20][40][2], double fn[3], double gn[3], double fg_i[42], double dx[13], double xd[7], double dxd[7]);
+void propagation(double t2000tt, double x[13], double Inertia[3][3], double I_inv[3][3], double M[3][3], double m, struct facets *fa, const struct facet_table *ft, double C[101][101], double S[101][101], int length_of_file[5], const struct space_weather *sw, struct density_cache *dc, struct jb2008_cache *jc, const struct density_table *dtab, const struct model_gating *mg, struct wind_cache *wc, const struct hwm14_model *hwm, struct magnet_coef *mc, struct magnet_arc *ma, struct time_scales *ts, struct frame_cache *fc, double G[14][14][25], double H[14][14][25], double G_wmm[13][13][8], double H_wmm[13][13][8], double model_parameters[N_MODEL_PARAMETERS], double eop[length_of_file[2]][10], double sun_eph[length_of_file[3]][3], double moon_eph[length_of_file[4]][3], struct cheb_ephemeris eph_cheb[2], double albedo[12][20][40][2], double fn[3], double gn[3], double fg_i[42], double energy[3], double dx[13], double xd[7], double dxd[7]);
 
 #endif /* propagation_h */
@@ -22,17 +22,13 @@
 //%
 //% OUTPUT:               double nu: portion of light blocked by Earth
 //%
-//% COUPLING:             - dotprod.c
-//%                       - norm.c
-//%                       - vectors2angle.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "shadow_function.h"
-#include "dotprod.h"
-#include "norm.h"
+#include "linalg.h"
 #include <math.h>
-#include "vectors2angle.h"
 
 double shadow_function(double r_sun[3], double p[3]){
     
@@ -41,8 +37,8 @@ double shadow_function(double r_sun[3], double p[3]){
     double alpha_umb = 0.264121687*M_PI/180.0;
     double alpha_pen = 0.269007205*M_PI/180.0;
     
-    double rrd = dotprod(p,r_sun);
-    double rn = norm(p);
+    double rrd = vec3_dot(p,r_sun);
+    double rn = vec3_norm(p);
     
     if (rrd < 0) {
         
@@ -50,7 +46,7 @@ double shadow_function(double r_sun[3], double p[3]){
         for (int i=0; i<3; i++)
             r_sun_neg[i] = -r_sun[i];
         
-        double sigma = vectors2angle(r_sun_neg,p);
+        double sigma = vec3_angle(r_sun_neg,p);
         double sat_hori = rn*cos(sigma);
         double sat_vert = rn*sin(sigma);
         double R_earth = 6378.137e3;
@@ -69,18 +65,18 @@ double shadow_function(double r_sun[3], double p[3]){
             else {
                 
                 double R_sun = 6.957e8;
-                double rsat = norm(p);
+                double rsat = vec3_norm(p);
                 
                 double rsr[3];
                 for (int i=0; i<3; i++)
                     rsr[i] = r_sun[i] - p[i];
-                double nrsr = norm(rsr);
+                double nrsr = vec3_norm(rsr);
                 
                 double a = asin(R_sun/nrsr);
                 
                 double b = asin(R_earth/rsat);
                 
-                double sdotr = dotprod(p,rsr);
+                double sdotr = vec3_dot(p,rsr);
                 
                 double c = acos(-sdotr/(rsat*nrsr));
                 
@@ -22,9 +22,7 @@
 //%
 //% OUTPUT:               double nu: portion of light blocked by Earth
 //%
-//% COUPLING:             - dotprod.c
-//%                       - norm.c
-//%                       - vectors2angle.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
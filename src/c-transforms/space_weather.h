@@ -0,0 +1,61 @@
+//
+//  space_weather.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        space_weather.h
+//%
+//% DESCRIPTION:          This structure contains the space-weather indices
+//%                       used by the atmospheric and wind models, loaded
+//%                       once by load_space_weather.c and indexed directly
+//%                       by epoch
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int space_weather.n_day: number of days (from
+//%                         January 1, 2000, UTC) of daily solar input
+//%                       double (*space_weather.daily)[3]: F10.7 of previous
+//%                         day, 81-day average F10.7 and daily Ap
+//%                       int space_weather.n_slot: number of 3-hour slots
+//%                         (from January 1, 2000, 00:00:00 UTC)
+//%                       double (*space_weather.ap_hist)[7]: NRLMSISE-00 ap
+//%                         history (struct ap_array) for each 3-hour slot
+//%                       double space_weather.sol1950: day (days since 1950)
+//%                         before the first JB2008 solar index record
+//%                       int space_weather.n_sol: number of JB2008 days
+//%                       double (*space_weather.sol)[8]: JB2008 F10, F10B,
+//%                         S10, S10B (1-day lag), M10, M10B (2-day lag), Y10,
+//%                         Y10B (5-day lag) for each day, 0 if missing
+//%                       double space_weather.dtc1950: time (days since
+//%                         1950) of the first DTC value
+//%                       int space_weather.n_dtc: number of hourly DTC values
+//%                       double *space_weather.dtc: hourly DTC values (K)
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef space_weather_h
+#define space_weather_h
+
+struct space_weather
+{
+    // NRLMSISE-00 and HWM14
+    int n_day;
+    double (*daily)[3];
+    int n_slot;
+    double (*ap_hist)[7];
+    
+    // JB2008
+    double sol1950;
+    int n_sol;
+    double (*sol)[8];
+    double dtc1950;
+    int n_dtc;
+    double *dtc;
+};
+
+#endif /* space_weather_h */
@@ -0,0 +1,63 @@
+//
+//  space_weather_jb2008.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        space_weather_jb2008.c
+//%
+//% DESCRIPTION:          This function returns the lagged JB2008 solar indices
+//%                       and the geomagnetic storm temperature change at an
+//%                       epoch from the space-weather store (replaces the
+//%                       SOLFSMY and DTCVAL file lookups of JB2008.for)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct space_weather *sw: space-weather store
+//%                       double D1950: days since January 0, 1950, 00:00:00 UTC
+//%
+//% OUTPUT:               double sol[8]: F10, F10B, S10, S10B, M10, M10B, Y10,
+//%                         Y10B (sfu)
+//%                       double *DSTDTC: temperature change from Dst (K)
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "space_weather_jb2008.h"
+#include <math.h>
+#include <stdlib.h>
+
+void space_weather_jb2008(const struct space_weather *sw, double D1950, double sol[8], double *DSTDTC){
+    
+    // Solar indices
+    int j = D1950 - sw->sol1950;
+    if ((j < 0) || (j >= sw->n_sol)){
+        fprintf(stderr, "\nError: epoch (D1950 = %.5f) is outside the 'SOLFSMY.TXT' values\n\n", D1950);
+        exit(-1);
+    }
+    for (int i = 0; i < 8; i++){
+        sol[i] = sw->sol[j][i];
+        if (sol[i] == 0){
+            fprintf(stderr, "\nError: missing solar indices in 'SOLFSMY.TXT' for epoch (D1950 = %.5f)\n\n", D1950);
+            exit(-1);
+        }
+    }
+    
+    // Storm temperature (hourly values, interpolated and rounded as in DTCVAL)
+    double fx = 1.0 + (D1950 - sw->dtc1950 + 0.0000001)*24.0;
+    int indx = fx;
+    if ((indx < 1) || (indx >= sw->n_dtc)){
+        fprintf(stderr, "\nError: epoch (D1950 = %.5f) is outside the 'DTCFILE.TXT' values\n\n", D1950);
+        exit(-1);
+    }
+    if (indx == 1)
+        *DSTDTC = sw->dtc[0];
+    else
+        *DSTDTC = (int)(sw->dtc[indx-1] + (fx-indx)*(sw->dtc[indx]-sw->dtc[indx-1]) + 0.5);
+    
+}
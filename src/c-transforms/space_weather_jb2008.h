@@ -0,0 +1,39 @@
+//
+//  space_weather_jb2008.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        space_weather_jb2008.c
+//%
+//% DESCRIPTION:          This function returns the lagged JB2008 solar indices
+//%                       and the geomagnetic storm temperature change at an
+//%                       epoch from the space-weather store (replaces the
+//%                       SOLFSMY and DTCVAL file lookups of JB2008.for)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct space_weather *sw: space-weather store
+//%                       double D1950: days since January 0, 1950, 00:00:00 UTC
+//%
+//% OUTPUT:               double sol[8]: F10, F10B, S10, S10B, M10, M10B, Y10,
+//%                         Y10B (sfu)
+//%                       double *DSTDTC: temperature change from Dst (K)
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef space_weather_jb2008_h
+#define space_weather_jb2008_h
+
+#include <stdio.h>
+#include "space_weather.h"
+
+void space_weather_jb2008(const struct space_weather *sw, double D1950, double sol[8], double *DSTDTC);
+
+#endif /* space_weather_jb2008_h */
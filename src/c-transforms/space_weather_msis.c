@@ -0,0 +1,50 @@
+//
+//  space_weather_msis.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        space_weather_msis.c
+//%
+//% DESCRIPTION:          This function returns the daily solar input and the
+//%                       NRLMSISE-00 ap history at an epoch from the
+//%                       space-weather store
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct space_weather *sw: space-weather store
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double daily[3]: F10.7 of previous day, 81-day
+//%                         average F10.7 and daily Ap
+//%                       double aph[7]: ap history (see struct ap_array in
+//%                         nrlmsise-00.h), aph[1] is the current 3-hour ap
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "space_weather_msis.h"
+#include <math.h>
+#include <stdlib.h>
+
+void space_weather_msis(const struct space_weather *sw, double t2000utc, double daily[3], double aph[7]){
+    
+    int day = floor(t2000utc/(24*60*60.0));
+    int slot = floor(t2000utc/(3*60*60.0));
+    
+    if ((slot < 0) || (slot >= sw->n_slot) || (day >= sw->n_day)){
+        fprintf(stderr, "\nError: epoch %.1f s is outside the 'ap_input.txt' and 'solar_input.txt' values\n\n", t2000utc);
+        exit(-1);
+    }
+    
+    for (int i = 0; i < 3; i++)
+        daily[i] = sw->daily[day][i];
+    for (int i = 0; i < 7; i++)
+        aph[i] = sw->ap_hist[slot][i];
+    
+}
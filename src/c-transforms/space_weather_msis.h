@@ -0,0 +1,39 @@
+//
+//  space_weather_msis.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        space_weather_msis.c
+//%
+//% DESCRIPTION:          This function returns the daily solar input and the
+//%                       NRLMSISE-00 ap history at an epoch from the
+//%                       space-weather store
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                const struct space_weather *sw: space-weather store
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%
+//% OUTPUT:               double daily[3]: F10.7 of previous day, 81-day
+//%                         average F10.7 and daily Ap
+//%                       double aph[7]: ap history (see struct ap_array in
+//%                         nrlmsise-00.h), aph[1] is the current 3-hour ap
+//%
+//% COUPLING:             - space_weather.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef space_weather_msis_h
+#define space_weather_msis_h
+
+#include <stdio.h>
+#include "space_weather.h"
+
+void space_weather_msis(const struct space_weather *sw, double t2000utc, double daily[3], double aph[7]);
+
+#endif /* space_weather_msis_h */
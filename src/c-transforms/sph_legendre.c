@@ -0,0 +1,160 @@
+//
+//  sph_legendre.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_legendre.c
+//%
+//% DESCRIPTION:          This function calculates the associated Legendre
+//%                       functions and their first and second angular
+//%                       derivatives for the spherical harmonic models
+//%                       (gravity and magnetic field), in one of two
+//%                       conventions:
+//%                         - SPH_GEODESY: unnormalized, argument is the
+//%                           geocentric latitude (EGM2008 with norm_coef.c)
+//%                         - SPH_SCHMIDT: Schmidt semi-normalized, argument
+//%                           is the colatitude (IGRF-12 and WMM), with the
+//%                           normalization factors of sph_schmidt.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int convention: SPH_GEODESY or SPH_SCHMIDT
+//%                       int order: highest derivative required (0, 1 or 2)
+//%                       int l_max: maximum degree
+//%                       double angle: latitude (SPH_GEODESY) or colatitude
+//%                         (SPH_SCHMIDT) (rad)
+//%                       int dim: dimension of output arrays (>= l_max+3)
+//%                       const double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]: Schmidt
+//%                         semi-normalization factors of sph_schmidt.c
+//%                         (SPH_SCHMIDT only, may be NULL for SPH_GEODESY)
+//%
+//% OUTPUT:               double P[dim][dim]: Legendre functions P[l][m]
+//%                       double dP[dim][dim]: first derivative with respect
+//%                         to angle (not used, and may be NULL, if order < 1)
+//%                       double ddP[dim][dim]: second derivative with respect
+//%                         to angle (not used, and may be NULL, if order < 2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "sph_legendre.h"
+#include <math.h>
+#include <stdlib.h>
+#include "sph_recurrence.h"
+
+void sph_legendre(int convention, int order, int l_max, double angle, int dim, const double (*S)[SPH_SCHMIDT_DIM], double P[dim][dim], double (*dP)[dim], double (*ddP)[dim]){
+    
+    if (dim < l_max+3){
+        fprintf(stderr, "\nError in sph_legendre: array dimension %d too small for degree %d\n\n", dim, l_max);
+        exit(-1);
+    }
+    if (((order >= 1) && (dP == NULL)) || ((order >= 2) && (ddP == NULL))){
+        fprintf(stderr, "\nError in sph_legendre: derivative array missing for order %d\n\n", order);
+        exit(-1);
+    }
+    
+    double s = sin(angle);
+    double c = cos(angle);
+    
+    // Initialize (entries with m > l must be zero for the recurrences)
+    for (int i=0; i<dim; i++){
+        for (int j=0; j<dim; j++){
+            P[i][j] = 0;
+            if (order >= 1)
+                dP[i][j] = 0;
+            if (order >= 2)
+                ddP[i][j] = 0;
+        }
+    }
+    
+    if (convention == SPH_GEODESY){
+        
+        // Unnormalized Legendre Polynomials of sin(lat)
+        P[0][0] = 1;
+        if (l_max >= 1){
+            P[1][0] = s;
+            P[1][1] = c;
+        }
+        for (int l = 2; l <= l_max ; ++l )
+            sph_geodesy_degree(l, 1, &s, &c, P[l-2], P[l-1], P[l]);
+        
+        // Derivatives with respect to latitude
+        double t = s/c;
+        if (order >= 1){
+            for (int l = 0; l <= l_max; l++)
+                sph_geodesy_derivative(l, 1, &t, P[l], dP[l]);
+        }
+        if (order >= 2){
+            for (int l = 0; l <= l_max; l++){
+                for (int m = 0; m <= l; m++)
+                    ddP[l][m] = P[l][m+2]-(2*m+1)*t*P[l][m+1]+(m*m*t*t-m/(c*c))*P[l][m];
+            }
+        }
+    }
+    else if (convention == SPH_SCHMIDT){
+        
+        if (S == NULL){
+            fprintf(stderr, "\nError in sph_legendre: Schmidt normalization factors missing\n\n");
+            exit(-1);
+        }
+        if (l_max >= SPH_SCHMIDT_DIM){
+            fprintf(stderr, "\nError in sph_legendre: degree %d too large for Schmidt normalization (maximum %d)\n\n", l_max, SPH_SCHMIDT_DIM-1);
+            exit(-1);
+        }
+        
+        // Gauss normalized associated Legendre functions of cos(colat)
+        P[0][0] = 1;
+        if (l_max >= 1)
+            P[1][0] = c;
+        for (int n=1; n<=l_max; n++)
+            P[n][n] = s*P[n-1][n-1];
+        for (int n=2; n<=l_max; n++){
+            for(int m=0; m<n; m++)
+                P[n][m] = c*P[n-1][m] - ((n-1)*(n-1)-m*m)*P[n-2][m]/((2*n-1)*(2*n-3));
+        }
+        if (order >= 1){
+            dP[0][0] = 0;
+            if (l_max >= 1)
+                dP[1][0] = -s;
+            for (int n=1; n<=l_max; n++)
+                dP[n][n] = s*dP[n-1][n-1] + c*P[n-1][n-1];
+            for (int n=2; n<=l_max; n++){
+                for (int m=0; m<n; m++)
+                    dP[n][m] = c*dP[n-1][m] - s*P[n-1][m] - ((n-1)*(n-1)-m*m)*dP[n-2][m]/((2*n-1)*(2*n-3));
+            }
+        }
+        if (order >= 2){
+            ddP[0][0] = 0;
+            if (l_max >= 1)
+                ddP[1][0] = -c;
+            for (int n=1; n<=l_max; n++)
+                ddP[n][n] = 2*c*dP[n-1][n-1] - s*P[n-1][n-1] + s*ddP[n-1][n-1];
+            for (int n=2; n<=l_max; n++){
+                for (int m=0; m<n; m++)
+                    ddP[n][m] = c*ddP[n-1][m] - 2*s*dP[n-1][m] - c*P[n-1][m] - ((n-1)*(n-1)-m*m)*ddP[n-2][m]/((2*n-1)*(2*n-3));
+            }
+        }
+        
+        // Schmidt semi-normalization
+        for (int n=0; n<=l_max; n++){
+            for (int m=0; m<=n; m++){
+                P[n][m] = P[n][m]*S[n][m];
+                if (order >= 1)
+                    dP[n][m] = dP[n][m]*S[n][m];
+                if (order >= 2)
+                    ddP[n][m] = ddP[n][m]*S[n][m];
+            }
+        }
+    }
+    else{
+        fprintf(stderr, "\nError in sph_legendre: unknown normalization convention %d\n\n", convention);
+        exit(-1);
+    }
+    
+}
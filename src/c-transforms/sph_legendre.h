@@ -0,0 +1,57 @@
+//
+//  sph_legendre.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_legendre.c
+//%
+//% DESCRIPTION:          This function calculates the associated Legendre
+//%                       functions and their first and second angular
+//%                       derivatives for the spherical harmonic models
+//%                       (gravity and magnetic field), in one of two
+//%                       conventions:
+//%                         - SPH_GEODESY: unnormalized, argument is the
+//%                           geocentric latitude (EGM2008 with norm_coef.c)
+//%                         - SPH_SCHMIDT: Schmidt semi-normalized, argument
+//%                           is the colatitude (IGRF-12 and WMM), with the
+//%                           normalization factors of sph_schmidt.c
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int convention: SPH_GEODESY or SPH_SCHMIDT
+//%                       int order: highest derivative required (0, 1 or 2)
+//%                       int l_max: maximum degree
+//%                       double angle: latitude (SPH_GEODESY) or colatitude
+//%                         (SPH_SCHMIDT) (rad)
+//%                       int dim: dimension of output arrays (>= l_max+3)
+//%                       const double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]: Schmidt
+//%                         semi-normalization factors of sph_schmidt.c
+//%                         (SPH_SCHMIDT only, may be NULL for SPH_GEODESY)
+//%
+//% OUTPUT:               double P[dim][dim]: Legendre functions P[l][m]
+//%                       double dP[dim][dim]: first derivative with respect
+//%                         to angle (not used, and may be NULL, if order < 1)
+//%                       double ddP[dim][dim]: second derivative with respect
+//%                         to angle (not used, and may be NULL, if order < 2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef sph_legendre_h
+#define sph_legendre_h
+
+#include <stdio.h>
+#include "sph_schmidt.h"
+
+#define SPH_GEODESY 1
+#define SPH_SCHMIDT 2
+
+void sph_legendre(int convention, int order, int l_max, double angle, int dim, const double (*S)[SPH_SCHMIDT_DIM], double P[dim][dim], double (*dP)[dim], double (*ddP)[dim]);
+
+#endif /* sph_legendre_h */
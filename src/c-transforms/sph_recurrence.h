@@ -0,0 +1,85 @@
+//
+//  sph_recurrence.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_recurrence.h
+//%
+//% DESCRIPTION:          This header contains the per-degree steps of the
+//%                       spherical harmonic engine, written for a number of
+//%                       lanes (positions evaluated together), so that the
+//%                       same code serves one position (sph_legendre.c,
+//%                       sph_synthesis.c, lanes = 1) and blocks of positions
+//%                       (gravity_field_batch.c). Rows are stored with the
+//%                       lanes innermost: element m of lane k is at
+//%                       [m*lanes + k]
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% FUNCTIONS:            void sph_geodesy_degree(l, lanes, s, c, P2, P1, P):
+//%                         unnormalized Legendre functions of degree l >= 2
+//%                         from degrees l-1 (P1) and l-2 (P2), with s and c
+//%                         the sine and cosine of latitude
+//%                       void sph_geodesy_derivative(l, lanes, t, P, dP):
+//%                         latitude derivatives of degree l, with t the
+//%                         tangent of latitude (P[l+1] must be 0)
+//%                       void sph_degree_sums(l, order, lanes, C, S, cml,
+//%                         sml, P, dP, ddP, s): degree-l sums s[10][lanes]
+//%                         of sph_synthesis.c (without the radial factors),
+//%                         with C, S the coefficients of degree l and cml,
+//%                         sml the cosines and sines of m*lon
+//%
+//% COUPLING:             None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef sph_recurrence_h
+#define sph_recurrence_h
+
+static inline void sph_geodesy_degree(int l, int lanes, const double *restrict s, const double *restrict c, const double *restrict P2, const double *restrict P1, double *restrict P){
+    for (int k = 0; k < lanes; k++)
+        P[k] = ((2*l-1)*s[k]*P1[k]-(l-1)*P2[k])/((double)l);
+    for (int m = 1; m < l; m++){
+        for (int k = 0; k < lanes; k++)
+            P[m*lanes+k] = P2[m*lanes+k]+(2*l-1)*c[k]*P1[(m-1)*lanes+k];
+    }
+    for (int k = 0; k < lanes; k++)
+        P[l*lanes+k] = (2*l-1)*c[k]*P1[(l-1)*lanes+k];
+}
+
+static inline void sph_geodesy_derivative(int l, int lanes, const double *restrict t, const double *restrict P, double *restrict dP){
+    for (int m = 0; m <= l; m++){
+        for (int k = 0; k < lanes; k++)
+            dP[m*lanes+k] = P[(m+1)*lanes+k]-m*t[k]*P[m*lanes+k];
+    }
+}
+
+static inline void sph_degree_sums(int l, int order, int lanes, const double *restrict C, const double *restrict S, const double *restrict cml, const double *restrict sml, const double *restrict P, const double *restrict dP, const double *restrict ddP, double *restrict s){
+    for (int i = 0; i < 10*lanes; i++)
+        s[i] = 0;
+    for (int m = 0; m <= l; m++){
+        double Clm = C[m], Slm = S[m];
+        for (int k = 0; k < lanes; k++){
+            int i = m*lanes + k;
+            double Q = Clm*cml[i] + Slm*sml[i];
+            s[k] = s[k] + P[i]*Q;
+            if (order >= 1){
+                double dQ = Slm*cml[i] - Clm*sml[i];
+                s[2*lanes+k] = s[2*lanes+k] + dP[i]*Q;
+                s[3*lanes+k] = s[3*lanes+k] + m*P[i]*dQ;
+                if (order >= 2){
+                    s[5*lanes+k] = s[5*lanes+k] + ddP[i]*Q;
+                    s[6*lanes+k] = s[6*lanes+k] + m*m*P[i]*Q;
+                    s[9*lanes+k] = s[9*lanes+k] + m*dP[i]*dQ;
+                }
+            }
+        }
+    }
+}
+
+#endif /* sph_recurrence_h */
@@ -0,0 +1,59 @@
+//
+//  sph_schmidt.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_schmidt.c
+//%
+//% DESCRIPTION:          This function calculates the Schmidt
+//%                       semi-normalization factors that sph_legendre.c
+//%                       applies to the Gauss normalized Legendre functions
+//%                       (SPH_SCHMIDT convention). They only depend on the
+//%                       degree and order, so they are computed once when
+//%                       the magnetic coefficient cache is created (main.c)
+//%                       and passed in
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]:
+//%                         normalization factors S[n][m] for degrees
+//%                         n < SPH_SCHMIDT_DIM (0 for m > n)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "sph_schmidt.h"
+#include <math.h>
+
+void sph_schmidt(double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]){
+    
+    double S_nm = 1, S_n0 = 1, delta;
+    for (int n=0; n<SPH_SCHMIDT_DIM; n++){
+        if (n > 0)
+            S_n0 = S_n0*(2*n-1)/n;
+        S_nm = S_n0;
+        for (int m=0; m<SPH_SCHMIDT_DIM; m++){
+            if (m > n){
+                S[n][m] = 0;
+                continue;
+            }
+            if (m > 0){
+                if (m==1)
+                    delta = 1;
+                else
+                    delta = 0;
+                S_nm = S_nm*sqrt((n-m+1)*(delta+1)/(n+m));
+            }
+            S[n][m] = S_nm;
+        }
+    }
+    
+}
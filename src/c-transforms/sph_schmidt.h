@@ -0,0 +1,43 @@
+//
+//  sph_schmidt.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_schmidt.c
+//%
+//% DESCRIPTION:          This function calculates the Schmidt
+//%                       semi-normalization factors that sph_legendre.c
+//%                       applies to the Gauss normalized Legendre functions
+//%                       (SPH_SCHMIDT convention). They only depend on the
+//%                       degree and order, so they are computed once when
+//%                       the magnetic coefficient cache is created (main.c)
+//%                       and passed in
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                None
+//%
+//% OUTPUT:               double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]:
+//%                         normalization factors S[n][m] for degrees
+//%                         n < SPH_SCHMIDT_DIM (0 for m > n)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef sph_schmidt_h
+#define sph_schmidt_h
+
+#include <stdio.h>
+
+// Dimension of the factor array (degrees up to SPH_SCHMIDT_DIM-1)
+#define SPH_SCHMIDT_DIM 16
+
+void sph_schmidt(double S[SPH_SCHMIDT_DIM][SPH_SCHMIDT_DIM]);
+
+#endif /* sph_schmidt_h */
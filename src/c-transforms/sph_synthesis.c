@@ -0,0 +1,100 @@
+//
+//  sph_synthesis.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_synthesis.c
+//%
+//% DESCRIPTION:          This function evaluates the spherical harmonic sums
+//%                       of a potential and of its partial derivatives from
+//%                       the Legendre functions of sph_legendre.c, with
+//%                       Q = C[l][m]*cos(m*lon) + S[l][m]*sin(m*lon) and
+//%                       Q' = S[l][m]*cos(m*lon) - C[l][m]*sin(m*lon)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int order: highest derivative required (0, 1 or 2)
+//%                       int l_min: minimum degree
+//%                       int l_max: maximum degree
+//%                       double rho: ratio of reference radius to distance
+//%                       double lon: longitude (rad)
+//%                       int dim: dimension of Legendre arrays
+//%                       double P[dim][dim]: Legendre functions
+//%                       double dP[dim][dim]: first angular derivatives (may
+//%                         be NULL if order < 1)
+//%                       double ddP[dim][dim]: second angular derivatives
+//%                         (may be NULL if order < 2)
+//%                       int n_coef: dimension of coefficient arrays
+//%                       const double C[n_coef][n_coef]: cosine coefficients
+//%                       const double S[n_coef][n_coef]: sine coefficients
+//%
+//% OUTPUT:               double sums[10]: sums over l_min <= l <= l_max,
+//%                         0 <= m <= l, of rho^l times:
+//%                         - sums[0]: P*Q
+//%                         - sums[1]: (l+1)*P*Q             (order >= 1)
+//%                         - sums[2]: dP*Q                  (order >= 1)
+//%                         - sums[3]: m*P*Q'                (order >= 1)
+//%                         - sums[4]: (l+1)*(l+2)*P*Q       (order 2)
+//%                         - sums[5]: ddP*Q                 (order 2)
+//%                         - sums[6]: m*m*P*Q               (order 2)
+//%                         - sums[7]: (l+1)*dP*Q            (order 2)
+//%                         - sums[8]: (l+1)*m*P*Q'          (order 2)
+//%                         - sums[9]: m*dP*Q'               (order 2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "sph_synthesis.h"
+#include <math.h>
+#include "sph_recurrence.h"
+
+void sph_synthesis(int order, int l_min, int l_max, double rho, double lon, int dim, double P[dim][dim], double (*dP)[dim], double (*ddP)[dim], int n_coef, const double C[n_coef][n_coef], const double S[n_coef][n_coef], double sums[10]){
+    
+    for (int i=0; i<10; i++)
+        sums[i] = 0;
+    
+    // cos(m*lon) and sin(m*lon) by angle addition
+    double cml[l_max+1], sml[l_max+1];
+    cml[0] = 1;
+    sml[0] = 0;
+    if (l_max >= 1){
+        cml[1] = cos(lon);
+        sml[1] = sin(lon);
+    }
+    for (int m = 2; m <= l_max; m++){
+        cml[m] = cml[m-1]*cml[1] - sml[m-1]*sml[1];
+        sml[m] = sml[m-1]*cml[1] + cml[m-1]*sml[1];
+    }
+    
+    double rhol = pow(rho,l_min);
+    for (int l = l_min; l <= l_max; l++){
+        
+        // Degree-l sums
+        double s[10];
+        sph_degree_sums(l, order, 1, C[l], S[l], cml, sml, P[l], (order >= 1) ? dP[l] : NULL, (order >= 2) ? ddP[l] : NULL, s);
+        
+        // Radial factors only depend on degree
+        sums[0] = sums[0] + rhol*s[0];
+        if (order >= 1){
+            sums[1] = sums[1] + rhol*(l+1)*s[0];
+            sums[2] = sums[2] + rhol*s[2];
+            sums[3] = sums[3] + rhol*s[3];
+        }
+        if (order >= 2){
+            sums[4] = sums[4] + rhol*(l+1)*(l+2)*s[0];
+            sums[5] = sums[5] + rhol*s[5];
+            sums[6] = sums[6] + rhol*s[6];
+            sums[7] = sums[7] + rhol*(l+1)*s[2];
+            sums[8] = sums[8] + rhol*(l+1)*s[3];
+            sums[9] = sums[9] + rhol*s[9];
+        }
+        rhol = rhol*rho;
+    }
+    
+}
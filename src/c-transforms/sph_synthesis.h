@@ -0,0 +1,60 @@
+//
+//  sph_synthesis.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sph_synthesis.c
+//%
+//% DESCRIPTION:          This function evaluates the spherical harmonic sums
+//%                       of a potential and of its partial derivatives from
+//%                       the Legendre functions of sph_legendre.c, with
+//%                       Q = C[l][m]*cos(m*lon) + S[l][m]*sin(m*lon) and
+//%                       Q' = S[l][m]*cos(m*lon) - C[l][m]*sin(m*lon)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                int order: highest derivative required (0, 1 or 2)
+//%                       int l_min: minimum degree
+//%                       int l_max: maximum degree
+//%                       double rho: ratio of reference radius to distance
+//%                       double lon: longitude (rad)
+//%                       int dim: dimension of Legendre arrays
+//%                       double P[dim][dim]: Legendre functions
+//%                       double dP[dim][dim]: first angular derivatives (may
+//%                         be NULL if order < 1)
+//%                       double ddP[dim][dim]: second angular derivatives
+//%                         (may be NULL if order < 2)
+//%                       int n_coef: dimension of coefficient arrays
+//%                       const double C[n_coef][n_coef]: cosine coefficients
+//%                       const double S[n_coef][n_coef]: sine coefficients
+//%
+//% OUTPUT:               double sums[10]: sums over l_min <= l <= l_max,
+//%                         0 <= m <= l, of rho^l times:
+//%                         - sums[0]: P*Q
+//%                         - sums[1]: (l+1)*P*Q             (order >= 1)
+//%                         - sums[2]: dP*Q                  (order >= 1)
+//%                         - sums[3]: m*P*Q'                (order >= 1)
+//%                         - sums[4]: (l+1)*(l+2)*P*Q       (order 2)
+//%                         - sums[5]: ddP*Q                 (order 2)
+//%                         - sums[6]: m*m*P*Q               (order 2)
+//%                         - sums[7]: (l+1)*dP*Q            (order 2)
+//%                         - sums[8]: (l+1)*m*P*Q'          (order 2)
+//%                         - sums[9]: m*dP*Q'               (order 2)
+//%
+//% COUPLING:             - sph_recurrence.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef sph_synthesis_h
+#define sph_synthesis_h
+
+#include <stdio.h>
+
+void sph_synthesis(int order, int l_min, int l_max, double rho, double lon, int dim, double P[dim][dim], double (*dP)[dim], double (*ddP)[dim], int n_coef, const double C[n_coef][n_coef], const double S[n_coef][n_coef], double sums[10]);
+
+#endif /* sph_synthesis_h */
@@ -9,7 +9,10 @@
 //% FUNCTION NAME:        srp.c
 //%
 //% DESCRIPTION:          This function calculates the solar radiation
-//%                       acceleration and torque for the entire surface model
+//%                       acceleration and torque for the entire surface model.
+//%                       The force and torque are evaluated together in body
+//%                       frame in a single pass over the surfaces in view of
+//%                       the sun, or interpolated in the facet response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 December 18, 2017
@@ -20,8 +23,9 @@
 //%                       double r_sun[3]: position of Sun (m)
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       int in_srp_a: inclusion of acceleration?
 //%                       int in_srp_g: inclusion of torque?
@@ -30,30 +34,28 @@
 //%                         in inertial frame
 //%                       double g_srp[3]: direct solar radiation torque
 //%                         in body-fixed frame
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces (without the table)
 //%
-//% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - norm.c
-//%                       - srp_force.c
-//%                       - crossprod.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_radiation.c
+//%                       - facet_table_eval.c
 //%                       - shadow_function.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "srp.h"
-#include "surface.h"
-#include "vectors2angle.h"
-#include "norm.h"
-#include "srp_force.h"
-#include "crossprod.h"
+#include "linalg.h"
+#include "facets.h"
+#include "facet_table.h"
+#include "facets_radiation.h"
+#include "facet_table_eval.h"
 #include <math.h>
-#include "matxvec.h"
-#include "invertmat.h"
 #include "shadow_function.h"
 
-void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, int in_srp_a, int in_srp_g, double a_srp[3], double g_srp[3]){
+void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, int in_srp_a, int in_srp_g, double a_srp[3], double g_srp[3]){
     
     // Initialize
     for (int i=0; i<3; i++){
@@ -62,7 +64,7 @@ void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_su
     }
     
     // Light direction unit vector
-    double rsun = norm(r_sun);
+    double rsun = vec3_norm(r_sun);
     double light[3];
     for (int i=0; i<3; i++){
         light[i] = -r_sun[i]/rsun;
@@ -70,29 +72,24 @@ void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_su
     
     // Switch from inertial frame to body frame
     double light_body[3];
-    matxvec(C_i2b, light, light_body);
+    mat3_vec(C_i2b, light, light_body);
     
     // Inverse body rotation matrix
     double C_b2i[3][3];
-    invertmat(C_i2b,C_b2i);
+    mat3_transpose(C_i2b,C_b2i);
     
-    // Find angle between light direction vector and surface normal to obtain surfaces in view of sun
-    double tot_proj_surf = 0;
-    double A_cross = 0;
-    double alpha[n_surf], cos_alpha[n_surf];
-    for (int i=0; i<n_surf; i++){
-        alpha[i] = vectors2angle(light_body,geometry[i].normal);
-        cos_alpha[i] = cos(alpha[i]);
-        // If surface is in view calculate projected surface area
-        if (cos_alpha[i]>0){
-            geometry[i].projected_area = cos_alpha[i]*geometry[i].area;
+    // Force and torque in body frame per unit pressure
+    double f_body[3], g_body[3];
+    if (ft->n > 0){
+        double fg[6];
+        facet_table_eval(ft, light_body, FACETS_DRAG_N, 6, fg);
+        for (int i=0; i<3; i++){
+            f_body[i] = fg[i];
+            g_body[i] = fg[3+i];
         }
-        else {
-            geometry[i].projected_area = 0;
-        }
-        tot_proj_surf = tot_proj_surf + geometry[i].projected_area;
     }
-    A_cross = tot_proj_surf;
+    else
+        facets_radiation(fa, light_body, f_body, g_body, NULL, NULL);
     
     // Photon flux calculation using shadow function
     double phi = 1361*(149597870700.0/rsun)*(149597870700.0/rsun);
@@ -103,52 +100,11 @@ void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_su
     double c = 299792458.0;
     double p_srp = phi/c;
     
-    //// FORCE CALCULATION
-    double f_srp[3];
-    for (int i=0; i<3; i++){
-        f_srp[i] = 0;
-    }
-    // For each surface
-    for (int i=0; i<n_surf; i++){
-        
-        // If in view
-        if (cos_alpha[i]>0){
-            
-            // Calculate force for that surface in inertial frame
-            double f_surf[3];
-            srp_force(geometry[i], cos_alpha[i], C_b2i, light, f_surf);
-            
-            // Sum total force in inertial frame
-            for (int j=0; j<3; j++)
-                f_srp[j] = f_srp[j] + f_surf[j];
-            
-            //// TORQUE CALCULATION
-            if (in_srp_g){
-                
-                // Force for that surface in body frame
-                double f_surf_b[3];
-                matxvec(C_i2b, f_surf, f_surf_b);
-                
-                // Calculate center of pressure in body frame
-                double cp_b[3];
-                cp_b[0] = (geometry[i].vertices[0][0] + geometry[i].vertices[0][1] + geometry[i].vertices[0][2])/3.0;
-                cp_b[1] = (geometry[i].vertices[1][0] + geometry[i].vertices[1][1] + geometry[i].vertices[1][2])/3.0;
-                cp_b[2] = (geometry[i].vertices[2][0] + geometry[i].vertices[2][1] + geometry[i].vertices[2][2])/3.0;
-                
-                // Torque for that surface
-                double g_surf[3];
-                crossprod(cp_b, f_surf_b, g_surf);
-                
-                // Sum up total torque in body frame
-                for (int j=0; j<3; j++)
-                    g_srp[j] = g_srp[j] + g_surf[j];
-                
-            }
-        }
-    }
-    
     //// ACCELERATION CALCULATION
     if (in_srp_a){
+        // Force in inertial frame
+        double f_srp[3];
+        mat3_vec(C_b2i, f_body, f_srp);
         // Multiply by flux
         for (int i=0; i<3; i++)
             a_srp[i] = p_srp*f_srp[i]/m;
@@ -158,7 +114,7 @@ void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_su
     if (in_srp_g){
         // Multiply by flux
         for (int i=0; i<3; i++)
-            g_srp[i] = p_srp*g_srp[i];
+            g_srp[i] = p_srp*g_body[i];
     }
     
 }
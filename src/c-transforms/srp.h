@@ -9,7 +9,10 @@
 //% FUNCTION NAME:        srp.c
 //%
 //% DESCRIPTION:          This function calculates the solar radiation
-//%                       acceleration and torque for the entire surface model
+//%                       acceleration and torque for the entire surface model.
+//%                       The force and torque are evaluated together in body
+//%                       frame in a single pass over the surfaces in view of
+//%                       the sun, or interpolated in the facet response table
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 December 18, 2018
@@ -20,8 +23,9 @@
 //%                       double r_sun[3]: position of Sun (m)
 //%                       double C_i2b[3][3]: rotation matrix from inertial
 //%                         frame to body frame
-//%                       int n_surf: number of surfaces in geometry model
-//%                       struct surface geometry[n_surf]: surface geometry model
+//%                       struct facets *fa: surface geometry model
+//%                       const struct facet_table *ft: facet response table
+//%                         (not used if ft->n is 0)
 //%                       double m: mass (kg)
 //%                       int in_srp_a: inclusion of acceleration?
 //%                       int in_srp_g: inclusion of torque?
@@ -30,14 +34,14 @@
 //%                         in inertial frame
 //%                       double g_srp[3]: direct solar radiation torque
 //%                         in body-fixed frame
+//%                       struct facets *fa: cosines and projected areas of
+//%                         the surfaces (without the table)
 //%
-//% COUPLING:             - surface.h
-//%                       - vectors2angle.c
-//%                       - norm.c
-//%                       - srp_force.c
-//%                       - crossprod.c
-//%                       - matxvec.c
-//%                       - invertmat.c
+//% COUPLING:             - facets.h
+//%                       - facet_table.h
+//%                       - linalg.h
+//%                       - facets_radiation.c
+//%                       - facet_table_eval.c
 //%                       - shadow_function.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -46,8 +50,9 @@
 #define srp_h
 
 #include <stdio.h>
-#include "surface.h"
+#include "facets.h"
+#include "facet_table.h"
 
-void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], int n_surf, struct surface geometry[n_surf], double m, int in_srp_a, int in_srp_g, double a_srp[3], double g_srp[3]);
+void srp(double p[3], double v[3], double r_sun[3], double C_i2b[3][3], struct facets *fa, const struct facet_table *ft, double m, int in_srp_a, int in_srp_g, double a_srp[3], double g_srp[3]);
 
 #endif /* srp_h */
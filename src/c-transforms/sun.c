@@ -15,38 +15,64 @@
 //% VERSION:              1
 //%
 //% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eph_model: 1 for tabulated ephemeris (linear
+//%                         interpolation); 2 for Chebyshev ephemeris; 3 for
+//%                         analytical series
 //%                       int length_of_file[5]: array with lengths of files
 //%                       double sun_eph[length_of_file[3]][3]: sun ephemerides
+//%                       const struct cheb_ephemeris *sun_cheb: Chebyshev
+//%                         ephemeris of the Sun
 //%
 //% OUTPUT:               double r_sun[3]: position of Sun in inertial frame
 //%                         (MOD, assumed to be equal to initial TEME) (m)
 //%                       double r: distance from Earth to Sun (m)
 //%
 //% COUPLING:             - norm.c
+//%                       - cheb_eval.c
+//%                       - sun_analytic.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "sun.h"
 #include <math.h>
 #include "norm.h"
+#include "cheb_eval.h"
+#include "sun_analytic.h"
 
-double sun(double t2000tt, int length_of_file[5], double sun_eph[length_of_file[3]][3], double r_sun[3]){
+double sun(double t2000tt, int eph_model, int length_of_file[5], double sun_eph[length_of_file[3]][3], const struct cheb_ephemeris *sun_cheb, double r_sun[3]){
     
     // Constants
     double au = 149597870700;
     
-    int xx = t2000tt/(12*60*60);
-    double xrem = fmod(t2000tt,12*60*60.0);
-    
-    double r0[3], r1[3];
-    for (int i=0; i<3; i++){
-        r0[i] = sun_eph[xx][i];
-        r1[i] = sun_eph[xx+1][i];
+    if (eph_model == 2){
+        
+        // Chebyshev ephemeris
+        cheb_eval(sun_cheb, t2000tt, r_sun, NULL);
+        
+    }
+    else if (eph_model == 3){
+        
+        // Analytical ephemeris
+        sun_analytic(t2000tt, r_sun);
+        
     }
+    else{
+        
+        // Tabulated ephemeris
+        int xx = t2000tt/(12*60*60);
+        double xrem = fmod(t2000tt,12*60*60.0);
     
-    // Sun position vector
-    for (int i=0; i<3; i++)
-        r_sun[i] = ((r1[i]-r0[i])*xrem/(12*60*60.0) + r0[i])*au;
+        double r0[3], r1[3];
+        for (int i=0; i<3; i++){
+            r0[i] = sun_eph[xx][i];
+            r1[i] = sun_eph[xx+1][i];
+        }
+    
+        // Sun position vector
+        for (int i=0; i<3; i++)
+            r_sun[i] = ((r1[i]-r0[i])*xrem/(12*60*60.0) + r0[i])*au;
+        
+    }
     
     // Earth - Sun distance
     double r = norm(r_sun);
@@ -15,14 +15,21 @@
 //% VERSION:              1
 //%
 //% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eph_model: 1 for tabulated ephemeris (linear
+//%                         interpolation); 2 for Chebyshev ephemeris; 3 for
+//%                         analytical series
 //%                       int length_of_file[5]: array with lengths of files
 //%                       double sun_eph[length_of_file[3]][3]: sun ephemerides
+//%                       const struct cheb_ephemeris *sun_cheb: Chebyshev
+//%                         ephemeris of the Sun
 //%
 //% OUTPUT:               double r_sun[3]: position of Sun in inertial frame
 //%                         (MOD, assumed to be equal to initial TEME) (m)
 //%                       double r: distance from Earth to Sun (m)
 //%
 //% COUPLING:             - norm.c
+//%                       - cheb_eval.c
+//%                       - sun_analytic.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -30,7 +37,8 @@
 #define sun_h
 
 #include <stdio.h>
+#include "cheb_ephemeris.h"
 
-double sun(double t2000tt, int length_of_file[5], double sun_eph[length_of_file[3]][3], double r_sun[3]);
+double sun(double t2000tt, int eph_model, int length_of_file[5], double sun_eph[length_of_file[3]][3], const struct cheb_ephemeris *sun_cheb, double r_sun[3]);
 
 #endif /* sun_h */
@@ -0,0 +1,63 @@
+//
+//  sun_analytic.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sun_analytic.c
+//%
+//% DESCRIPTION:          This function calculates a low-precision position
+//%                       of the Sun from an analytical series (Meeus (1998)
+//%                       Astronomical Algorithms, Chapter 25). Accuracy is
+//%                       about 0.01 deg in direction and 1e-4 au in distance
+//%                       and no ephemeris file is needed
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r_sun[3]: position of Sun in inertial frame
+//%                         (mean equator and equinox of date) (m)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "sun_analytic.h"
+#include <math.h>
+
+void sun_analytic(double t2000tt, double r_sun[3]){
+    
+    // Constants
+    double deg = M_PI/180.0;
+    double arcsec = deg/3600.0;
+    double au = 149597870700;
+    
+    // Julian centuries (TT) since J2000.0
+    double T = (t2000tt - 12*60*60.0)/(36525*24*60*60.0);
+    
+    // Mean longitude (mean equinox of date), mean anomaly and eccentricity
+    double L0 = (280.46646 + 36000.76983*T)*deg;
+    double M = (357.52911 + 35999.05029*T)*deg;
+    double e = 0.016708634 - 0.000042037*T;
+    
+    // Equation of the center
+    double C = ((1.914602 - 0.004817*T)*sin(M) + (0.019993 - 0.000101*T)*sin(2*M) + 0.000289*sin(3*M))*deg;
+    
+    // Ecliptic longitude and distance
+    double lambda = L0 + C;
+    double r = 1.000001018*(1 - e*e)/(1 + e*cos(M + C))*au;
+    
+    // Mean obliquity of the ecliptic
+    double eps = 23.43929111*deg - 46.8150*T*arcsec;
+    
+    // Equatorial position
+    r_sun[0] = r*cos(lambda);
+    r_sun[1] = r*sin(lambda)*cos(eps);
+    r_sun[2] = r*sin(lambda)*sin(eps);
+    
+}
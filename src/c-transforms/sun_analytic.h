@@ -0,0 +1,37 @@
+//
+//  sun_analytic.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        sun_analytic.c
+//%
+//% DESCRIPTION:          This function calculates a low-precision position
+//%                       of the Sun from an analytical series (Meeus (1998)
+//%                       Astronomical Algorithms, Chapter 25). Accuracy is
+//%                       about 0.01 deg in direction and 1e-4 au in distance
+//%                       and no ephemeris file is needed
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%
+//% OUTPUT:               double r_sun[3]: position of Sun in inertial frame
+//%                         (mean equator and equinox of date) (m)
+//%
+//% COUPLING:             - None
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef sun_analytic_h
+#define sun_analytic_h
+
+#include <stdio.h>
+
+void sun_analytic(double t2000tt, double r_sun[3]);
+
+#endif /* sun_analytic_h */
@@ -6,10 +6,11 @@
 //  Copyright © 2018 Luc Sagnieres. All rights reserved.
 //
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-//% FUNCTION NAME:        days2mdh.c
+//% FUNCTION NAME:        t2doy.c
 //%
 //% DESCRIPTION:          This function converts t2000 to the year, day of
-//%                       year, and seconds of day
+//%                       year, and seconds of day in closed form (Gregorian
+//%                       calendar)
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 November 5, 2016
@@ -23,45 +24,37 @@
 //%                         - time[2]: days since January 1, 2000
 //%                       double sec: seconds of day
 //%
-//% COUPLING:             None
+//% COUPLING:             - date2days.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "t2doy.h"
+#include "date2days.h"
 #include <math.h>
 
 double t2doy(double t2000, int time[3]){
     
-    double sec;
+    // Days since January 1, 2000 and seconds of day
+    int days = (int) floor(t2000/(24*60*60.0));
+    double sec = t2000 - days*24*60*60.0;
+    if (sec < 0){
+        days = days - 1;
+        sec = t2000 - days*24*60*60.0;
+    }
     
-    time[0] = 2000;
-    time[1] = 0;
-    time[2] = 0;
-    int daysinyear;
-    double temp_sec = t2000;
+    // Year from the day of the 400-year cycle (years starting on March 1)
+    int z = days + 730425;
+    int era = ((z >= 0) ? z : z-146096)/146097;
+    int doe = z - era*146097;
+    int yoe = (doe - doe/1460 + doe/36524 - doe/146096)/365;
+    int doy = doe - (365*yoe + yoe/4 - yoe/100);
+    int year = yoe + era*400;
+    if (doy >= 306)     // January and February
+        year = year + 1;
     
-    int go = 1;
-    while (go) {
-        
-        if (((time[0]-2000) % 4)==0)
-            daysinyear = 366;
-        else
-            daysinyear = 365;
-        
-        temp_sec = temp_sec - daysinyear*24*60*60.0;
-        time[0] = time[0] + 1;
-        time[2] = time[2] + daysinyear;
-        
-        if (temp_sec<0){
-            go=0;
-            temp_sec = temp_sec + daysinyear*24*60*60.0;
-            time[0] = time[0] - 1;
-            time[2] = time[2] - daysinyear;
-        }
-    }
-    time[1] = (int) (floor(temp_sec/(24*60*60.0))+1.0);
-    time[2] = time[2] + time[1];
-    sec = temp_sec - 24*60*60*(time[1]-1);
+    time[0] = year;
+    time[1] = days - date2days(year, 1, 1) + 1;
+    time[2] = days + 1;
     
     return sec;
     
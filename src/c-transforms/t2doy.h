@@ -6,10 +6,11 @@
 //  Copyright © 2018 Luc Sagnieres. All rights reserved.
 //
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-//% FUNCTION NAME:        days2mdh.c
+//% FUNCTION NAME:        t2doy.c
 //%
 //% DESCRIPTION:          This function converts t2000 to the year, day of
-//%                       year, and seconds of day
+//%                       year, and seconds of day in closed form (Gregorian
+//%                       calendar)
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 November 5, 2016
@@ -23,7 +24,7 @@
 //%                         - time[2]: days since January 1, 2000
 //%                       double sec: seconds of day
 //%
-//% COUPLING:             None
+//% COUPLING:             - date2days.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
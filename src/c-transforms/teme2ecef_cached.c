@@ -0,0 +1,112 @@
+//
+//  teme2ecef_cached.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        teme2ecef_cached.c
+//%
+//% DESCRIPTION:          This function converts the position and velocity
+//%                       vectors from the TEME frame to the ECEF frame as
+//%                       teme2ecef.c, computing the sidereal time and polar
+//%                       motion rotations only when the epoch or the Earth
+//%                       orientation parameters change (once per step, the
+//%                       stages only apply the cached matrices)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct frame_cache *fc: rotation cache
+//%                       double r_teme[3]: position vector in TEME (m)
+//%                       double v_teme[3]: velocity vector in TEME (m s-1)
+//%                       double ttt: julian centuries of terrestrial time
+//%                       double t2000ut1: seconds since January 1, 2000, 00:00:00 UT1
+//%                       double xp: polar motion parameter from EOP
+//%                       double yp: polar motion parameter from EOP
+//%                       double lod: length of day from EOP
+//%
+//% OUTPUT:               double r_ecef[3]: position vector in ECEF (m)
+//%                       double v_ecef[3]: velocity vector in ECEF (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from
+//%                         ECEF to TEME
+//%
+//% COUPLING:             - frame_cache.h
+//%                       - linalg.h
+//%                       - polarm.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "teme2ecef_cached.h"
+#include "linalg.h"
+#include <math.h>
+#include "polarm.h"
+
+void teme2ecef_cached(struct frame_cache *fc, double r_teme[3], double v_teme[3], double ttt, double t2000ut1, double xp, double yp, double lod, double r_ecef[3], double v_ecef[3], double C_ecef2teme[3][3]){
+    
+    fc->n_calls++;
+    
+    if (!fc->valid || (t2000ut1 != fc->t2000ut1) || (ttt != fc->ttt) || (xp != fc->xp) || (yp != fc->yp) || (lod != fc->lod)){
+        
+        // Calculate GMST from J2000+dUT1
+        double gmst;
+        double tut1 = (t2000ut1-(12*60*60.0))/(60*60*24*36525.0);
+        double temp = - 6.2e-6 * tut1 * tut1 * tut1 + 0.093104 * tut1 * tut1 + (876600.0 * 3600.0 + 8640184.812866) * tut1 + 67310.54841;
+        temp = fmod( temp*M_PI/180.0/240.0, 2*M_PI );
+        if (temp<0.0)
+            temp = temp+2*M_PI;
+        gmst = temp;
+        
+        // Rotation matrix from PEF to TEME considering sidereal time with GMST
+        double st[3][3];
+        st[0][0] =  cos(gmst);
+        st[0][1] = -sin(gmst);
+        st[0][2] =  0.0;
+        st[1][0] =  sin(gmst);
+        st[1][1] =  cos(gmst);
+        st[1][2] =  0.0;
+        st[2][0] =  0.0;
+        st[2][1] =  0.0;
+        st[2][2] =  1.0;
+        mat3_transpose(st,fc->st_t);
+        
+        // Rotation matrix from ECEF to PEF considering polar motion
+        double pm[3][3];
+        polarm(xp,yp,ttt,pm);
+        mat3_transpose(pm,fc->pm_t);
+        mat3_mult(st, pm, fc->C_ecef2teme);
+        
+        // Earth angular velocity
+        fc->omegaearth[0] = 0;
+        fc->omegaearth[1] = 0;
+        fc->omegaearth[2] = 7.29211514670698e-05 * (1.0  - lod/86400.0 );
+        
+        fc->t2000ut1 = t2000ut1;
+        fc->ttt = ttt;
+        fc->xp = xp;
+        fc->yp = yp;
+        fc->lod = lod;
+        fc->valid = 1;
+        fc->n_updates++;
+    }
+    
+    // Position transformation
+    double r_pef[3];
+    mat3_vec(fc->st_t,r_teme,r_pef);
+    mat3_vec(fc->pm_t,r_pef,r_ecef);
+    for (int i=0; i<3; i++){
+        for (int j=0; j<3; j++)
+            C_ecef2teme[i][j] = fc->C_ecef2teme[i][j];
+    }
+    
+    // Velocity transformation
+    double v_pef[3], v_temp[3];
+    mat3_vec(fc->st_t,v_teme,v_pef);
+    vec3_cross(fc->omegaearth,r_pef,v_temp);
+    for (int i=0; i<3; i++)
+        v_pef[i] = v_pef[i] - v_temp[i];
+    mat3_vec(fc->pm_t,v_pef,v_ecef);
+    
+}
@@ -0,0 +1,50 @@
+//
+//  teme2ecef_cached.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        teme2ecef_cached.c
+//%
+//% DESCRIPTION:          This function converts the position and velocity
+//%                       vectors from the TEME frame to the ECEF frame as
+//%                       teme2ecef.c, computing the sidereal time and polar
+//%                       motion rotations only when the epoch or the Earth
+//%                       orientation parameters change (once per step, the
+//%                       stages only apply the cached matrices)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct frame_cache *fc: rotation cache
+//%                       double r_teme[3]: position vector in TEME (m)
+//%                       double v_teme[3]: velocity vector in TEME (m s-1)
+//%                       double ttt: julian centuries of terrestrial time
+//%                       double t2000ut1: seconds since January 1, 2000, 00:00:00 UT1
+//%                       double xp: polar motion parameter from EOP
+//%                       double yp: polar motion parameter from EOP
+//%                       double lod: length of day from EOP
+//%
+//% OUTPUT:               double r_ecef[3]: position vector in ECEF (m)
+//%                       double v_ecef[3]: velocity vector in ECEF (m s-1)
+//%                       double C_ecef2teme[3][3]: rotation matrix from
+//%                         ECEF to TEME
+//%
+//% COUPLING:             - frame_cache.h
+//%                       - linalg.h
+//%                       - polarm.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef teme2ecef_cached_h
+#define teme2ecef_cached_h
+
+#include <stdio.h>
+#include "frame_cache.h"
+
+void teme2ecef_cached(struct frame_cache *fc, double r_teme[3], double v_teme[3], double ttt, double t2000ut1, double xp, double yp, double lod, double r_ecef[3], double v_ecef[3], double C_ecef2teme[3][3]);
+
+#endif /* teme2ecef_cached_h */
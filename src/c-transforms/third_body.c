@@ -21,30 +21,28 @@
 //%
 //% OUTPUT:               double a_third[3]: acceleration vector due to 3rd body
 //%
-//% COUPLING:             - norm.c
-//%                       - dotprod.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "third_body.h"
-#include "norm.h"
+#include "linalg.h"
 #include <math.h>
-#include "dotprod.h"
 
 void third_body(double p[3], double p_third[3], double mu_third, double a_third[3]){
     
     double mu = 3986004.418*pow(10,8);
     
-    double p_third_norm = norm(p_third);
+    double p_third_norm = vec3_norm(p_third);
     
     double p_sat3[3];
     for(int i=0; i<3; i++)
         p_sat3[i] = p_third[i]-p[i];
-    double p_sat3_norm = norm(p_sat3);
+    double p_sat3_norm = vec3_norm(p_sat3);
     
-    double p_norm = norm(p);
+    double p_norm = vec3_norm(p);
     
-    double Q = ((p_norm*p_norm+2*dotprod(p,p_sat3)) * (p_third_norm*p_third_norm + p_third_norm*p_sat3_norm + p_sat3_norm*p_sat3_norm)) / (p_third_norm*p_third_norm*p_third_norm*p_sat3_norm*p_sat3_norm*p_sat3_norm*(p_third_norm + p_sat3_norm));
+    double Q = ((p_norm*p_norm+2*vec3_dot(p,p_sat3)) * (p_third_norm*p_third_norm + p_third_norm*p_sat3_norm + p_sat3_norm*p_sat3_norm)) / (p_third_norm*p_third_norm*p_third_norm*p_sat3_norm*p_sat3_norm*p_sat3_norm*(p_third_norm + p_sat3_norm));
     
     for (int i=0; i<3; i++)
         a_third[i] = mu_third*(Q*p_sat3[i] - p[i]/(p_third_norm*p_third_norm*p_third_norm));
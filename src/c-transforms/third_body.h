@@ -21,8 +21,7 @@
 //%
 //% OUTPUT:               double a_third[3]: acceleration vector due to 3rd body
 //%
-//% COUPLING:             - norm.c
-//%                       - dotprod.c
+//% COUPLING:             - linalg.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -0,0 +1,77 @@
+//
+//  time_scales.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        time_scales.h
+//%
+//% DESCRIPTION:          This structure contains the leap second table
+//%                       loaded by load_time_scales.c and the time scales of
+//%                       the last epoch requested from time_scales_update.c
+//%                       with its Earth orientation parameters (all
+//%                       integrator stages of a step share it)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           int time_scales.n_leap: number of leap second
+//%                         entries
+//%                       double time_scales.leap_t2000utc[]: start of each
+//%                         entry (s since January 1, 2000, 00:00:00 UTC)
+//%                       double time_scales.leap_dat[]: TAI-UTC from the
+//%                         start of each entry (s)
+//%                       int time_scales.valid: 1 if the epoch below is set
+//%                       double time_scales.t2000tt: epoch (s since
+//%                         January 1, 2000, 00:00:00 TT)
+//%                       int time_scales.eop_model: 1 if the Earth
+//%                         orientation parameters are included
+//%                       double time_scales.t2000utc: epoch in UTC
+//%                       double time_scales.t2000ut1: epoch in UT1
+//%                       double time_scales.ttt: Julian centuries of TT
+//%                       int time_scales.time[3]: UTC year, day of year and
+//%                         days since January 1, 2000 (see t2doy.c)
+//%                       double time_scales.sec: UTC seconds of day
+//%                       double time_scales.xp, yp: polar motion (rad)
+//%                       double time_scales.dut1: UT1-UTC (s)
+//%                       double time_scales.lod: length of day (s)
+//%                       long time_scales.n_calls: number of requests
+//%                       long time_scales.n_updates: number of epochs set
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef time_scales_h
+#define time_scales_h
+
+#define TIME_SCALES_MAX_LEAP 100
+
+struct time_scales
+{
+    // Leap second table
+    int n_leap;
+    double leap_t2000utc[TIME_SCALES_MAX_LEAP];
+    double leap_dat[TIME_SCALES_MAX_LEAP];
+    
+    // Last epoch
+    int valid;
+    double t2000tt;
+    int eop_model;
+    double t2000utc;
+    double t2000ut1;
+    double ttt;
+    int time[3];
+    double sec;
+    double xp;
+    double yp;
+    double dut1;
+    double lod;
+    
+    // Statistics
+    long n_calls;
+    long n_updates;
+};
+
+#endif /* time_scales_h */
@@ -0,0 +1,74 @@
+//
+//  time_scales_update.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        time_scales_update.c
+//%
+//% DESCRIPTION:          This function sets the UTC, UT1, TT Julian
+//%                       centuries, day of year, seconds of day and Earth
+//%                       orientation parameters of an epoch given in
+//%                       terrestrial time, unless they are already set for
+//%                       this epoch (integrator stages at the same time)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct time_scales *ts: leap second table and
+//%                         epoch cache
+//%                       double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eop_model: 1 to interpolate the Earth
+//%                         orientation parameters, 0 to set them to zero
+//%                       int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%
+//% OUTPUT:               struct time_scales *ts: time scales at t2000tt
+//%
+//% COUPLING:             - tt2utc.c
+//%                       - t2doy.c
+//%                       - eop_interp.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "time_scales_update.h"
+#include "tt2utc.h"
+#include "t2doy.h"
+#include "eop_interp.h"
+
+void time_scales_update(struct time_scales *ts, double t2000tt, int eop_model, int n_eop, double eop[n_eop][10]){
+    
+    ts->n_calls++;
+    if (ts->valid && (t2000tt == ts->t2000tt) && (eop_model == ts->eop_model))
+        return;
+    
+    ts->t2000tt = t2000tt;
+    ts->eop_model = eop_model;
+    ts->t2000utc = tt2utc(t2000tt, ts);
+    ts->ttt = (t2000tt-(12*60*60.0))/(60*60*24*36525.0);   // julian centuries of TT
+    ts->sec = t2doy(ts->t2000utc, ts->time);
+    
+    // Earth orientation parameters (sidereal time only if not included)
+    if (eop_model == 1){
+        double eop_t[4];
+        eop_interp(n_eop, eop, ts->t2000utc, eop_t);
+        ts->xp = eop_t[0];
+        ts->yp = eop_t[1];
+        ts->dut1 = eop_t[2];
+        ts->lod = eop_t[3];
+    }
+    else{
+        ts->xp = 0;
+        ts->yp = 0;
+        ts->dut1 = 0;
+        ts->lod = 0;
+    }
+    ts->t2000ut1 = ts->t2000utc + ts->dut1;
+    
+    ts->valid = 1;
+    ts->n_updates++;
+    
+}
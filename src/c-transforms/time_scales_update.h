@@ -0,0 +1,45 @@
+//
+//  time_scales_update.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        time_scales_update.c
+//%
+//% DESCRIPTION:          This function sets the UTC, UT1, TT Julian
+//%                       centuries, day of year, seconds of day and Earth
+//%                       orientation parameters of an epoch given in
+//%                       terrestrial time, unless they are already set for
+//%                       this epoch (integrator stages at the same time)
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct time_scales *ts: leap second table and
+//%                         epoch cache
+//%                       double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       int eop_model: 1 to interpolate the Earth
+//%                         orientation parameters, 0 to set them to zero
+//%                       int n_eop: number of days in eop.txt
+//%                       double eop[n_eop][10]: earth orientation parameters
+//%
+//% OUTPUT:               struct time_scales *ts: time scales at t2000tt
+//%
+//% COUPLING:             - tt2utc.c
+//%                       - t2doy.c
+//%                       - eop_interp.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef time_scales_update_h
+#define time_scales_update_h
+
+#include <stdio.h>
+#include "time_scales.h"
+
+void time_scales_update(struct time_scales *ts, double t2000tt, int eop_model, int n_eop, double eop[n_eop][10]);
+
+#endif /* time_scales_update_h */
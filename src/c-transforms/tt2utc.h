@@ -10,17 +10,18 @@
 //%
 //% DESCRIPTION:          This function converts terrestrial time to UTC by
 //%                       going through atomic time and including leap seconds
-//%                       (last leap second included is December 31 2016)
+//%                       from the table in data/leap_seconds.txt
 //%
 //% AUTHOR:               Luc Sagnieres
 //% DATE:                 November 10, 2017
 //% VERSION:              1
 //%
 //% INPUT:                double t2000tt: seconds since January 1, 2000, 00:00:00 TT
+//%                       const struct time_scales *ts: leap second table
 //%
 //% OUTPUT:               double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
 //%
-//% COUPLING:             None
+//% COUPLING:             - time_scales.h
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -28,7 +29,8 @@
 #define tt2utc_h
 
 #include <stdio.h>
+#include "time_scales.h"
 
-double tt2utc(double t2000tt);
+double tt2utc(double t2000tt, const struct time_scales *ts);
 
 #endif /* tt2utc_h */
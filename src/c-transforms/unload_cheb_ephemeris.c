@@ -0,0 +1,40 @@
+//
+//  unload_cheb_ephemeris.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        unload_cheb_ephemeris.c
+//%
+//% DESCRIPTION:          This function unmaps a Chebyshev ephemeris mapped
+//%                       by load_cheb_ephemeris.c. Ephemerides that were not
+//%                       loaded (map is NULL) are left untouched
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct cheb_ephemeris *eph: mapped ephemeris
+//%
+//% OUTPUT:               struct cheb_ephemeris *eph: unmapped ephemeris
+//%
+//% COUPLING:             - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "unload_cheb_ephemeris.h"
+#include <sys/mman.h>
+
+void unload_cheb_ephemeris(struct cheb_ephemeris *eph){
+    
+    if (eph->map == NULL)
+        return;
+    
+    munmap(eph->map, eph->map_size);
+    eph->map = NULL;
+    eph->map_size = 0;
+    eph->coef = NULL;
+    
+}
@@ -0,0 +1,35 @@
+//
+//  unload_cheb_ephemeris.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        unload_cheb_ephemeris.c
+//%
+//% DESCRIPTION:          This function unmaps a Chebyshev ephemeris mapped
+//%                       by load_cheb_ephemeris.c. Ephemerides that were not
+//%                       loaded (map is NULL) are left untouched
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct cheb_ephemeris *eph: mapped ephemeris
+//%
+//% OUTPUT:               struct cheb_ephemeris *eph: unmapped ephemeris
+//%
+//% COUPLING:             - cheb_ephemeris.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef unload_cheb_ephemeris_h
+#define unload_cheb_ephemeris_h
+
+#include <stdio.h>
+#include "cheb_ephemeris.h"
+
+void unload_cheb_ephemeris(struct cheb_ephemeris *eph);
+
+#endif /* unload_cheb_ephemeris_h */
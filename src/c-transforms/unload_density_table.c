@@ -0,0 +1,40 @@
+//
+//  unload_density_table.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        unload_density_table.c
+//%
+//% DESCRIPTION:          This function unmaps a density table mapped by
+//%                       load_density_table.c. Tables that were not loaded
+//%                       (map is NULL) are left untouched
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct density_table *tab: mapped density table
+//%
+//% OUTPUT:               struct density_table *tab: unmapped density table
+//%
+//% COUPLING:             - density_table.h
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "unload_density_table.h"
+#include <sys/mman.h>
+
+void unload_density_table(struct density_table *tab){
+    
+    if (tab->map == NULL)
+        return;
+    
+    munmap(tab->map, tab->map_size);
+    tab->map = NULL;
+    tab->map_size = 0;
+    tab->log_rho = NULL;
+    
+}
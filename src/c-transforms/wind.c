@@ -22,93 +22,65 @@
 //%                         - LLA[2]: longitude (rad)
 //%                         - LLA[3]: altitude (km)
 //%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
-//%                       int length_of_file[5]: array containing length of file values
-//%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct wind_cache *wc: along-track HWM14 wind cache
+//%                         (used if its sampling interval is not 0)
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native HWM14 model
 //%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
 //%                       int wind_model: which wind model?
 //%
 //% OUTPUT:               double winds_i[3]: wind velocity at satellite
 //%                         position (m s-1)
 //%
-//% COUPLING:             - t2doy.c
-//%                       - crossprod.c
-//%                       - matxvec.c
+//% COUPLING:             - linalg.h
+//%                       - space_weather_msis.c
+//%                       - wind_hwm14.c
+//%                       - wind_cached.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 #include "wind.h"
-#include "t2doy.h"
+#include "linalg.h"
 #include <math.h>
-#include "crossprod.h"
-#include "matxvec.h"
+#include "space_weather_msis.h"
+#include "wind_hwm14.h"
+#include "wind_cached.h"
 
-extern void hwm14_(int *iyd, float *sec, float *alt, float *lat, float *lon, float *stl, float f107a[2], float f107[2], float ap[2], float w[2]);
-
-void wind(double p_ecef[3], double LLA[4], double t2000utc, int length_of_file[5], double ap_index[length_of_file[0]], double C_ecef2teme[3][3], int wind_model, double winds_i[3]){
+void wind(double p_ecef[3], double LLA[4], double t2000utc, const struct space_weather *sw, struct wind_cache *wc, const struct hwm14_model *hwm, double C_ecef2teme[3][3], int wind_model, double winds_i[3]){
 
     double winds_ecef[3] = {0,0,0};
     
-    // Horizontal Wind Model 2014
-    if (wind_model==1){
-        
-        // Set up input for HWM14
-        int time[3];
-        float sec = (float) t2doy(t2000utc,time);
-        int year = time[0];
-        int day = time[1];
-        int iyd = 1000*(year-2000)+day;
-        float lat = LLA[1]*180/M_PI;    // geodetic latitude
-        float lon = LLA[2]*180/M_PI;    // longitude
-        float alt = LLA[3];             // km
-        
-        // Not used
-        float stl = 0;
-        float f107[2] = {0,0};
-        float f107a[2] = {0,0};
-        float ap[2] = {0,0};
-        
-        float w[2];
+    // Horizontal Wind Model 2014 (1: Fortran, 2: native)
+    if ((wind_model==1)||(wind_model==2)){
         
         // Current 3h ap
-        int i=day;
-        if (sec<3*3600)
-            ap[1] = ap_index[(i+2)*8+1];
-        else if (sec<6*3600)
-            ap[1] = ap_index[(i+2)*8+2];
-        else if (sec<9*3600)
-            ap[1] = ap_index[(i+2)*8+3];
-        else if (sec<12*3600)
-            ap[1] = ap_index[(i+2)*8+4];
-        else if (sec<15*3600)
-            ap[1] = ap_index[(i+2)*8+5];
-        else if (sec<18*3600)
-            ap[1] = ap_index[(i+2)*8+6];
-        else if (sec<21*3600)
-            ap[1] = ap_index[(i+2)*8+7];
-        else
-            ap[1] = ap_index[(i+2)*8+8];
+        double daily[3], aph[7];
+        space_weather_msis(sw, t2000utc, daily, aph);
         
-        // Horizontal Wind Model 2014
-        hwm14_(&iyd,&sec,&alt,&lat,&lon,&stl,f107a,f107,ap,w);
+        // Horizontal Wind Model 2014 (sampled along track if cached)
+        const struct hwm14_model *model = (wind_model==2) ? hwm : NULL;
         double winds_ned[3] = {0,0,0};
-        winds_ned[0] = w[0];
-        winds_ned[1] = w[1];
+        if (wc->cadence > 0)
+            wind_cached(wc, LLA, t2000utc, aph[1], model, winds_ned);
+        else
+            wind_hwm14(LLA, t2000utc, aph[1], model, winds_ned);
         
         // Rotate to inertial frame
         double C_ned2ecef[3][3] = {
             {-sin(LLA[1])*cos(LLA[2]),    -sin(LLA[2]),  -cos(LLA[1])*cos(LLA[2])},
             {-sin(LLA[1])*sin(LLA[2]),    cos(LLA[2]),   -cos(LLA[1])*sin(LLA[2])},
             {cos(LLA[1]),              0,          -sin(LLA[1])}};
-        matxvec(C_ned2ecef,winds_ned,winds_ecef);
+        mat3_vec(C_ned2ecef,winds_ned,winds_ecef);
     }
     
     // Co-rotating Winds (Neglect Polar Motion and Length of Day)
     double thetasa= 7.29211514670698*pow(10,-05);
     double omegaearth[3] = {0, 0, thetasa};
     double w_earth[3];
-    crossprod(omegaearth,p_ecef,w_earth);
+    vec3_cross(omegaearth,p_ecef,w_earth);
     for (int i=0; i<3; i++)
         winds_ecef[i] = winds_ecef[i] + w_earth[i];
-    matxvec(C_ecef2teme,winds_ecef,winds_i);
+    mat3_vec(C_ecef2teme,winds_ecef,winds_i);
 
 }
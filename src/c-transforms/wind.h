@@ -22,17 +22,21 @@
 //%                         - LLA[2]: longitude (rad)
 //%                         - LLA[3]: altitude (km)
 //%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
-//%                       int length_of_file[5]: array containing length of file values
-//%                       double ap_index[length_of_file[0]]: Ap array for NRLMSISE-00
+//%                       const struct space_weather *sw: space-weather store
+//%                       struct wind_cache *wc: along-track HWM14 wind cache
+//%                         (used if its sampling interval is not 0)
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native HWM14 model
 //%                       double C_ecef2teme[3][3]: rotation matrix from ECEF to TEME
 //%                       int wind_model: which wind model?
 //%
 //% OUTPUT:               double winds_i[3]: wind velocity at satellite
 //%                         position (m s-1)
 //%
-//% COUPLING:             - t2doy.c
-//%                       - crossprod.c
-//%                       - matxvec.c
+//% COUPLING:             - linalg.h
+//%                       - space_weather_msis.c
+//%                       - wind_hwm14.c
+//%                       - wind_cached.c
 //%
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
@@ -40,7 +44,10 @@
 #define wind_h
 
 #include <stdio.h>
+#include "space_weather.h"
+#include "wind_cache.h"
+#include "hwm14_model.h"
 
-void wind(double p_ecef[3], double LLA[4], double t2000utc, int length_of_file[5], double ap_index[length_of_file[0]], double C_ecef2teme[3][3], int wind_model, double winds_i[3]);
+void wind(double p_ecef[3], double LLA[4], double t2000utc, const struct space_weather *sw, struct wind_cache *wc, const struct hwm14_model *hwm, double C_ecef2teme[3][3], int wind_model, double winds_i[3]);
 
 #endif /* wind_h */
@@ -0,0 +1,53 @@
+//
+//  wind_cache.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        wind_cache.h
+//%
+//% DESCRIPTION:          This structure contains the along-track HWM14 wind
+//%                       cache used by wind_cached.c: the last two samples
+//%                       of the horizontal wind, the sampling interval and
+//%                       statistics
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% PROPERTIES:           double wind_cache.cadence: sampling interval (s),
+//%                         0 to disable the cache
+//%                       int wind_cache.valid: number of samples (0 to 2)
+//%                       double wind_cache.ap: 3-hour ap of the samples
+//%                       double wind_cache.t[2]: times of the previous and
+//%                         last samples (s since January 1, 2000, 00:00:00
+//%                         UTC)
+//%                       double wind_cache.w[2][2]: northward and eastward
+//%                         winds of the previous and last samples (m s-1)
+//%                       long wind_cache.n_calls: number of requests
+//%                       long wind_cache.n_samples: number of HWM14 calls
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef wind_cache_h
+#define wind_cache_h
+
+struct wind_cache
+{
+    // Settings
+    double cadence;
+    
+    // Samples
+    int valid;
+    double ap;
+    double t[2];
+    double w[2][2];
+    
+    // Statistics
+    long n_calls;
+    long n_samples;
+};
+
+#endif /* wind_cache_h */
@@ -0,0 +1,78 @@
+//
+//  wind_cached.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        wind_cached.c
+//%
+//% DESCRIPTION:          This function will obtain the HWM14 horizontal
+//%                       wind from samples taken along the trajectory. The
+//%                       model is sampled when the last sample is older
+//%                       than the sampling interval (or when the 3-hour ap
+//%                       changes). Only the current position is known, so
+//%                       the wind after the last sample is extrapolated
+//%                       linearly in time from the last two samples; the
+//%                       extrapolation time is clamped to the spacing of
+//%                       these samples. All integrator stages of a step
+//%                       share the step time, so they use the same value
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct wind_cache *wc: wind cache
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double ap: current 3-hour ap index
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native model (hwm14.f90 is used if NULL)
+//%
+//% OUTPUT:               double winds_ne[2]: northward and eastward wind
+//%                         (m s-1)
+//%
+//% COUPLING:             - wind_hwm14.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "wind_cached.h"
+#include "wind_hwm14.h"
+#include <math.h>
+
+void wind_cached(struct wind_cache *wc, double LLA[4], double t2000utc, double ap, const struct hwm14_model *hwm, double winds_ne[2]){
+    
+    wc->n_calls++;
+    
+    // New sample (the previous one is kept for the time rate)
+    if ((wc->valid == 0) || (ap != wc->ap) || (t2000utc < wc->t[1]) || (t2000utc - wc->t[1] >= wc->cadence)){
+        if ((wc->valid == 0) || (ap != wc->ap) || (t2000utc < wc->t[1]))
+            wc->valid = 0;
+        wc->t[0] = wc->t[1];
+        wc->w[0][0] = wc->w[1][0];
+        wc->w[0][1] = wc->w[1][1];
+        wind_hwm14(LLA, t2000utc, ap, hwm, wc->w[1]);
+        wc->t[1] = t2000utc;
+        wc->ap = ap;
+        if (wc->valid < 2)
+            wc->valid++;
+        wc->n_samples++;
+    }
+    
+    // Linear extrapolation from the last two samples, at most one sample spacing ahead
+    double rate[2] = {0,0};
+    double dt = t2000utc - wc->t[1];
+    if (wc->valid == 2){
+        rate[0] = (wc->w[1][0] - wc->w[0][0])/(wc->t[1] - wc->t[0]);
+        rate[1] = (wc->w[1][1] - wc->w[0][1])/(wc->t[1] - wc->t[0]);
+        dt = fmin(dt, wc->t[1] - wc->t[0]);
+    }
+    winds_ne[0] = wc->w[1][0] + rate[0]*dt;
+    winds_ne[1] = wc->w[1][1] + rate[1]*dt;
+    
+}
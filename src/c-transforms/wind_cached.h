@@ -0,0 +1,53 @@
+//
+//  wind_cached.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        wind_cached.c
+//%
+//% DESCRIPTION:          This function will obtain the HWM14 horizontal
+//%                       wind from samples taken along the trajectory. The
+//%                       model is sampled when the last sample is older
+//%                       than the sampling interval (or when the 3-hour ap
+//%                       changes). Only the current position is known, so
+//%                       the wind after the last sample is extrapolated
+//%                       linearly in time from the last two samples; the
+//%                       extrapolation time is clamped to the spacing of
+//%                       these samples. All integrator stages of a step
+//%                       share the step time, so they use the same value
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                struct wind_cache *wc: wind cache
+//%                       double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double ap: current 3-hour ap index
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native model (hwm14.f90 is used if NULL)
+//%
+//% OUTPUT:               double winds_ne[2]: northward and eastward wind
+//%                         (m s-1)
+//%
+//% COUPLING:             - wind_hwm14.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef wind_cached_h
+#define wind_cached_h
+
+#include <stdio.h>
+#include "wind_cache.h"
+#include "hwm14_model.h"
+
+void wind_cached(struct wind_cache *wc, double LLA[4], double t2000utc, double ap, const struct hwm14_model *hwm, double winds_ne[2]);
+
+#endif /* wind_cached_h */
@@ -0,0 +1,83 @@
+//
+//  wind_hwm14.c
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        wind_hwm14.c
+//%
+//% DESCRIPTION:          This function will calculate the horizontal wind
+//%                       at satellite position from the Horizontal Wind
+//%                       Model 2014 (quiet-time and disturbance winds),
+//%                       either with the original single-precision Fortran
+//%                       model or with the double-precision C version
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double ap: current 3-hour ap index
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native model (hwm14.f90 is used if NULL)
+//%
+//% OUTPUT:               double winds_ne[2]: northward and eastward wind
+//%                         (m s-1)
+//%
+//% COUPLING:             - t2doy.c
+//%                       - hwm14.f90
+//%                       - hwm14_native.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#include "wind_hwm14.h"
+#include "t2doy.h"
+#include "hwm14_native.h"
+#include <math.h>
+
+extern void hwm14_(int *iyd, float *sec, float *alt, float *lat, float *lon, float *stl, float f107a[2], float f107[2], float ap[2], float w[2]);
+
+void wind_hwm14(double LLA[4], double t2000utc, double ap, const struct hwm14_model *hwm, double winds_ne[2]){
+    
+    // Set up input for HWM14
+    int time[3];
+    double sec_utc = t2doy(t2000utc,time);
+    int year = time[0];
+    int day = time[1];
+    int iyd = 1000*(year-2000)+day;
+    
+    // Native model (double precision)
+    if (hwm != NULL){
+        hwm14_eval(hwm, iyd, sec_utc, ap, LLA[3], LLA[1]*180/M_PI, LLA[2]*180/M_PI, winds_ne);
+        return;
+    }
+    
+    float sec = sec_utc;
+    float lat = LLA[1]*180/M_PI;    // geodetic latitude
+    float lon = LLA[2]*180/M_PI;    // longitude
+    float alt = LLA[3];             // km
+    
+    // Not used
+    float stl = 0;
+    float f107[2] = {0,0};
+    float f107a[2] = {0,0};
+    float ap_hwm[2] = {0,0};
+    
+    float w[2];
+    
+    // Current 3h ap
+    ap_hwm[1] = ap;
+    
+    // Horizontal Wind Model 2014
+    hwm14_(&iyd,&sec,&alt,&lat,&lon,&stl,f107a,f107,ap_hwm,w);
+    winds_ne[0] = w[0];
+    winds_ne[1] = w[1];
+    
+}
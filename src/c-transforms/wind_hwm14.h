@@ -0,0 +1,48 @@
+//
+//  wind_hwm14.h
+//  D-SPOSE
+//
+//  Created by D-SPOSE contributors on 2026-10-19.
+//  Copyright © 2026 D-SPOSE contributors. All rights reserved.
+//
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//% FUNCTION NAME:        wind_hwm14.c
+//%
+//% DESCRIPTION:          This function will calculate the horizontal wind
+//%                       at satellite position from the Horizontal Wind
+//%                       Model 2014 (quiet-time and disturbance winds),
+//%                       either with the original single-precision Fortran
+//%                       model or with the double-precision C version
+//%
+//% AUTHOR:               D-SPOSE contributors
+//% DATE:                 October 19, 2026
+//% VERSION:              1
+//%
+//% INPUT:                double LLA[4]:
+//%                         - LLA[0]: geocentric latitude (rad)
+//%                         - LLA[1]: geodetic latitude (rad)
+//%                         - LLA[2]: longitude (rad)
+//%                         - LLA[3]: altitude (km)
+//%                       double t2000utc: seconds since January 1, 2000, 00:00:00 UTC
+//%                       double ap: current 3-hour ap index
+//%                       const struct hwm14_model *hwm: coefficients of the
+//%                         native model (hwm14.f90 is used if NULL)
+//%
+//% OUTPUT:               double winds_ne[2]: northward and eastward wind
+//%                         (m s-1)
+//%
+//% COUPLING:             - t2doy.c
+//%                       - hwm14.f90
+//%                       - hwm14_native.c
+//%
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef wind_hwm14_h
+#define wind_hwm14_h
+
+#include <stdio.h>
+#include "hwm14_model.h"
+
+void wind_hwm14(double LLA[4], double t2000utc, double ap, const struct hwm14_model *hwm, double winds_ne[2]);
+
+#endif /* wind_hwm14_h */